@@ -1,23 +1,129 @@
 #ifndef ALGORITMO_GENETICO_H
 #define ALGORITMO_GENETICO_H
 
+#include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <vector>
 
+class ThreadPool;
+template <typename T>
+class SpscQueue;
+
+// Genoma de length bits empacotados em palavras de 64 bits (bit i em
+// words[i / 64], posição i % 64); os bits acima do comprimento são zero.
+// É só uma visão: aponta para a memória da população.
+struct GenomaView {
+    const std::uint64_t* words;
+    std::size_t length;
+
+    bool gene(std::size_t i) const { return (words[i / 64] >> (i % 64)) & 1; }
+    std::size_t word_count() const { return (length + 63) / 64; }
+    std::size_t count_ones() const;
+};
+
+struct Individuo {
+    std::vector<std::uint64_t> genes;
+    double fitness = 0.0;
+};
+
+// Para quem cada ilha envia migrantes: a seguinte num anel, ou uma
+// sorteada a cada migração
+enum class MigrationTopology { Ring, Random };
+
 class AlgoritmoGenetico {
 public:
-    AlgoritmoGenetico(int popular_size, int generations);
+    // Fitness a maximizar de um genoma
+    using FitnessFunction = std::function<double(const GenomaView&)>;
+    // Fitness de count genomas de uma vez: fitness[i] para genomes[i]
+    using BatchFitnessFunction = std::function<void(const GenomaView* genomes, std::size_t count, double* fitness)>;
+
+    // OneMax (número de bits 1)
+    AlgoritmoGenetico(int popular_size, int generations, std::size_t genome_length = 10,
+                      double mutation_rate = 0.01);
+    AlgoritmoGenetico(int popular_size, int generations, std::size_t genome_length,
+                      FitnessFunction fitness_func, double mutation_rate = 0.01);
+    AlgoritmoGenetico(int popular_size, int generations, std::size_t genome_length,
+                      BatchFitnessFunction batch_fitness_func, double mutation_rate = 0.01);
+
     void run();
+    const std::vector<std::uint64_t>& get_best_solution() const;
+    double get_best_fitness() const;
+    std::size_t get_genome_length() const;
+    std::size_t get_evaluations() const;
+    // Avalia (e gera descendentes) em paralelo no pool; nullptr volta ao sequencial
+    void set_thread_pool(ThreadPool* pool);
+    // Mesma semente, mesmo resultado, com qualquer número de threads
+    // (no modelo de ilhas a chegada de migrantes depende do tempo)
+    void set_seed(std::uint64_t seed);
+    // Divide a população em islands subpopulações, cada uma evoluindo na
+    // sua thread; a cada migration_interval gerações cada ilha envia cópias
+    // dos seus migrants melhores, que substituem os piores do destino.
+    // Com mais ilhas que indivíduos, roda uma ilha por indivíduo; acima de
+    // 65535 ilhas lança invalid_argument
+    void set_island_model(int islands, int migration_interval, int migrants,
+                          MigrationTopology topology = MigrationTopology::Ring);
+    std::size_t get_migrants_received() const;
+    // Seleção por torneio entre size indivíduos sorteados (padrão 2)
+    void set_tournament_size(int size);
+    // Quantos melhores passam intactos para a geração seguinte (padrão 1)
+    void set_elitism(int count);
 
 private:
     int popular_size;
     int generations;
-    void inicialize_popular();
-    void evaluate_popular();
-    void select_parents();
-    void crossover();
-    void mutate();
+    std::size_t genome_length;
+    std::size_t words;  // palavras de 64 bits por genoma
+    double mutation_rate;
+    FitnessFunction fitness_function;
+    BatchFitnessFunction batch_fitness_function;
+    ThreadPool* pool;
+    std::uint64_t seed;
+    int islands;
+    int migration_interval;
+    int migrants;
+    MigrationTopology topology;
+    int tournament_size;
+    int elitism;
+
+    // Subpopulação; a execução sem ilhas usa uma só. Os genomas ficam numa
+    // arena contígua com dois buffers (geração atual e a próxima): os
+    // filhos são escritos direto no outro buffer e os buffers trocam de
+    // papel. Todos os vetores são dimensionados na inicialização, e o laço
+    // de gerações (sem pool) não aloca memória.
+    struct Ilha {
+        std::uint64_t id = 0;
+        std::size_t size = 0;
+        int current = 0;                     // buffer da geração atual
+        std::vector<std::uint64_t> arena;    // 2 * size genomas
+        std::vector<double> fitness;         // da geração atual
+        std::vector<GenomaView> views;       // genomas da geração atual
+        std::vector<std::uint32_t> order;    // índices para nth_element
+        std::vector<std::uint32_t> parents;  // dois por par de filhos
+        std::vector<Individuo> arrivals;     // migrantes recebidos
+        Individuo outgoing;
+        Individuo best;
+        std::size_t evaluations = 0;
+        std::size_t received = 0;
+    };
+
+    std::uint64_t* genome(Ilha& ilha, int buffer, std::size_t i) const;
+    std::size_t elite_count(const Ilha& ilha) const;
+    void inicialize_popular(Ilha& ilha, std::size_t size);
+    void evaluate_popular(Ilha& ilha);
+    void select_parents(Ilha& ilha, int generation);
+    void crossover(Ilha& ilha, int generation);
+    void mutate(Ilha& ilha, int generation);
+    void rank_best(Ilha& ilha, std::size_t count);
+    void emigrate(Ilha& ilha, SpscQueue<Individuo>& target, std::size_t count);
+    void immigrate(Ilha& ilha, SpscQueue<Individuo>* const* sources, std::size_t source_count, std::size_t limit);
+    void run_islands(std::size_t k);
+    template <typename Fn>
+    void for_each_block(std::size_t count, Fn fn);
 
-    std::vector<std::vector<int>> populacao;
+    Individuo best;
+    std::size_t evaluations;
+    std::size_t migrants_received;
 };
 
-#endif
\ No newline at end of file
+#endif
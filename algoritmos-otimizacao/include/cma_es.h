@@ -0,0 +1,114 @@
+#ifndef CMA_ES_H
+#define CMA_ES_H
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+class Xoshiro256;
+
+/**
+ * CMA-ES (Covariance Matrix Adaptation Evolution Strategy) com reinícios IPOP
+ *
+ * Objetivo:
+ *   Minimizar funções contínuas com o mínimo de avaliações. A cada
+ *   geração lambda pontos são sorteados de uma normal N(m, sigma^2 C); os
+ *   mu melhores movem a média m, e a matriz de covariância C aprende a
+ *   forma do vale (caminho de evolução pc e atualização rank-mu). Em
+ *   funções mal condicionadas como Rosenbrock, onde PSO e SA dão passos
+ *   isotrópicos, C alinha a busca com o vale e o passo sigma é ajustado
+ *   pelo caminho conjugado ps.
+ *     - Sortear de N(0, C) exige C = B D^2 B^T. A decomposição é feita
+ *       por Jacobi cíclico, sem BLAS, e só a cada ~1 / (10 N (c1 + cmu))
+ *       gerações (atualização preguiçosa): entre uma e outra a amostragem
+ *       usa os B e D antigos, e o custo por geração cai de O(N^3) para
+ *       O(lambda N^2).
+ *     - IPOP: quando a busca estagna (fitness plano, passo minúsculo,
+ *       C mal condicionada ou limite de gerações), recomeça de um ponto
+ *       aleatório com o dobro da população; populações grandes acham o
+ *       mínimo global de funções multimodais como Rastrigin.
+ *   Limites: cada ponto é avaliado projetado na caixa [min_bound,
+ *   max_bound], com penalidade pela distância quadrada até a projeção
+ *   para a distribuição não escapar dela.
+ *
+ * Complexidade:
+ *   - Por geração: O(lambda N^2 + lambda * avaliação)
+ *   - Decomposição: O(N^3) por varredura de Jacobi, amortizada pelas
+ *     gerações entre decomposições
+ *   - Espaço: O(N^2 + lambda N)
+ */
+
+class CMAEvolutionStrategy {
+public:
+    CMAEvolutionStrategy(int dimensions, int max_evaluations,
+                         std::function<double(const std::vector<double>&)> fitness_func,
+                         double min_bound = -10.0, double max_bound = 10.0);
+
+    void run();
+    std::vector<double> get_best_solution() const;
+    double get_best_fitness() const;
+    void print_results() const;
+    int get_evaluations() const;
+    int get_restarts() const;
+    // Para assim que uma avaliação chegar a target (padrão: só pelo orçamento)
+    void set_target_fitness(double target);
+    // Passo inicial; o padrão é um quarto da largura da caixa
+    void set_initial_sigma(double sigma);
+    // População da primeira execução; o padrão é 4 + 3 ln(N)
+    void set_population_size(int lambda);
+    // Reinícios IPOP, cada um com o dobro da população (padrão 9)
+    void set_max_restarts(int restarts);
+    void set_seed(std::uint64_t seed);
+
+private:
+    std::function<double(const std::vector<double>&)> fitness_function;
+    int dimensions;
+    int max_evaluations;
+    double min_bound;
+    double max_bound;
+    double target_fitness;
+    double initial_sigma;
+    int initial_lambda;
+    int max_restarts;
+    std::uint64_t seed;
+
+    std::vector<double> best_solution;
+    double best_fitness;
+    int evaluations;
+    int restarts;
+
+    // Parâmetros da execução atual (dependem de lambda)
+    int lambda;
+    int mu;
+    std::vector<double> weights;
+    double mueff;
+    double cc, cs, c1, cmu, damps, chi_n;
+
+    // Estado da distribuição
+    std::vector<double> mean;
+    double sigma;
+    double start_sigma;
+    std::vector<double> pc, ps;
+    std::vector<double> C;  // N x N, linha a linha
+    std::vector<double> B;  // autovetores de C nas colunas
+    std::vector<double> D;  // raízes dos autovalores
+    int eigen_evaluation;   // avaliações na última decomposição
+
+    // Geração: lambda linhas de N
+    std::vector<double> arz, ary, arx;
+    std::vector<double> candidate;  // ponto projetado na caixa
+    std::vector<double> y_mean, whitened;
+    std::vector<double> fitness;
+    std::vector<int> order;
+    std::vector<double> history;  // melhor fitness das últimas gerações
+
+    void initialize_run(int population, Xoshiro256& rng);
+    bool sample_and_evaluate(Xoshiro256& rng);
+    double evaluate(const double* x);
+    void update_distribution(int generation);
+    void update_eigensystem();
+    bool should_restart(int generation, int max_generations) const;
+    bool finished() const;
+};
+
+#endif
@@ -1,19 +1,19 @@
 #ifndef PARTICLE_SWARM_OPTIMIZATION_H
 #define PARTICLE_SWARM_OPTIMIZATION_H
 
+#include <cstddef>
+#include <cstdint>
 #include <vector>
 #include <functional>
 
-struct Particle {
-    std::vector<double> position;
-    std::vector<double> velocity;
-    std::vector<double> best_position;
-    double fitness;
-    double best_fitness;
-
-    Particle(int dimensions);
-};
-
+// O enxame é guardado como matrizes partículas x dimensões contíguas
+// (posições, velocidades, melhores posições), cada linha com stride
+// múltiplo de 4 doubles. Velocidade, posição e limites são atualizados
+// numa só passada por linha, 4 dimensões por vez com AVX2, com os números
+// aleatórios vindo de Xoshiro256x4. O melhor global é só o índice da
+// partícula cuja melhor posição ele é: nada é copiado quando ele muda.
+// Cada partícula de cada iteração tem o seu gerador: mesma semente, mesmo
+// resultado.
 class ParticleSwarmOptimization {
 public:
     ParticleSwarmOptimization(int num_particles, int dimensions, int max_iterations,
@@ -24,6 +24,7 @@ public:
     std::vector<double> get_best_solution() const;
     double get_best_fitness() const;
     void print_results() const;
+    void set_seed(std::uint64_t seed);
 
 private:
     int num_particles;
@@ -34,20 +35,26 @@ private:
     double inertia_weight;
     double cognitive_coef;
     double social_coef;
+    std::uint64_t seed;
 
-    std::vector<Particle> swarm;
-    std::vector<double> global_best_position;
-    double global_best_fitness;
+    std::size_t stride;  // dimensions arredondado para múltiplo de 4
+    std::vector<double> positions;
+    std::vector<double> velocities;
+    std::vector<double> best_positions;
+    std::vector<double> fitness;
+    std::vector<double> best_fitness;
+    std::vector<double> candidate;  // linha copiada para a função de fitness
+    int global_best;                // partícula com a melhor posição já vista
 
     std::function<double(const std::vector<double>&)> fitness_function;
 
+    double* row(std::vector<double>& matrix, int particle);
+    const double* row(const std::vector<double>& matrix, int particle) const;
     void initialize_swarm();
     void evaluate_fitness();
     void update_personal_best();
     void update_global_best();
-    void update_velocities();
-    void update_positions();
-    void clamp_positions();
+    void update_swarm(int iteration);
 };
 
 #endif
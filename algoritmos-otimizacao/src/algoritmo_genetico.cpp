@@ -1,71 +1,384 @@
 #include "algoritmo_genetico.h"
+#include "spsc_queue.h"
+#include "thread_pool.h"
+#include "xoshiro.h"
 #include <iostream>
 #include <vector>
 #include <algorithm>
-#include <random>
 #include <ctime>
+#include <cmath>
+#include <memory>
+#include <stdexcept>
+#include <thread>
 
-std::mt19937 rng(static_cast<unsigned int>(std::time(nullptr)));
+namespace {
 
-AlgoritmoGenetico::AlgoritmoGenetico(int pop_tam, int gen) 
-    : popular_size(pop_tam), generations(gen) {}
+const std::size_t WORD_BITS = 64;
 
-void AlgoritmoGenetico::inicialize_popular() {
-    std::uniform_int_distribution<int> dist(0, 1);
-    populacao.resize(popular_size, std::vector<int>(10));
-    for (auto& individual : populacao) {
-        for (auto& gene : individual) {
-            gene = dist(rng);
-        }
+// Fluxos de números aleatórios: cada fase de cada geração de cada ilha
+// tem o seu, e dentro dela cada indivíduo (ou par) tem um gerador próprio
+enum RngPhase : std::uint64_t {
+    PHASE_INIT = 1, PHASE_SELECTION = 2, PHASE_CROSSOVER = 3, PHASE_MUTATION = 4, PHASE_MIGRATION = 5
+};
+
+// A ilha ocupa 16 bits do fluxo: mais ilhas repetiriam fluxos de outras
+const int MAX_ISLANDS = 0xFFFF;
+
+std::uint64_t stream_id(RngPhase phase, int generation, std::uint64_t island) {
+    return (((static_cast<std::uint64_t>(generation) << 16) | island) << 3) | phase;
+}
+
+// Máscara dos bits válidos da última palavra do genoma
+std::uint64_t tail_mask(std::size_t genome_length) {
+    std::size_t used = genome_length % WORD_BITS;
+    return used == 0 ? ~std::uint64_t(0) : (std::uint64_t(1) << used) - 1;
+}
+
+}
+
+std::size_t GenomaView::count_ones() const {
+    std::size_t ones = 0;
+    for (std::size_t w = 0; w < word_count(); ++w) {
+        ones += static_cast<std::size_t>(__builtin_popcountll(words[w]));
     }
+    return ones;
+}
+
+AlgoritmoGenetico::AlgoritmoGenetico(int pop_tam, int gen, std::size_t genome_length, double mutation_rate)
+    : AlgoritmoGenetico(pop_tam, gen, genome_length,
+                        FitnessFunction([](const GenomaView& genome) {
+                            return static_cast<double>(genome.count_ones());
+                        }),
+                        mutation_rate) {}
+
+AlgoritmoGenetico::AlgoritmoGenetico(int pop_tam, int gen, std::size_t genome_length,
+                                     FitnessFunction fitness_func, double mutation_rate)
+    : popular_size(pop_tam), generations(gen), genome_length(genome_length),
+      words((genome_length + WORD_BITS - 1) / WORD_BITS), mutation_rate(mutation_rate),
+      fitness_function(fitness_func), pool(nullptr),
+      seed(static_cast<std::uint64_t>(std::time(nullptr))),
+      islands(1), migration_interval(0), migrants(0), topology(MigrationTopology::Ring),
+      tournament_size(2), elitism(1), evaluations(0), migrants_received(0) {}
+
+AlgoritmoGenetico::AlgoritmoGenetico(int pop_tam, int gen, std::size_t genome_length,
+                                     BatchFitnessFunction batch_fitness_func, double mutation_rate)
+    : AlgoritmoGenetico(pop_tam, gen, genome_length, FitnessFunction(), mutation_rate) {
+    batch_fitness_function = batch_fitness_func;
 }
 
-void AlgoritmoGenetico::evaluate_popular() {
-    for (auto& individual : populacao) {
-        int fitness = std::count(individual.begin(), individual.end(), 1);
+// fn(lo, hi) sobre blocos de [0, count), no pool se houver
+template <typename Fn>
+void AlgoritmoGenetico::for_each_block(std::size_t count, Fn fn) {
+    if (pool == nullptr) {
+        fn(std::size_t(0), count);
+        return;
     }
+    std::size_t grain = std::max<std::size_t>(1, count / (4 * pool->size()));
+    parallel_for(*pool, 0, count, grain, fn);
+}
+
+std::uint64_t* AlgoritmoGenetico::genome(Ilha& ilha, int buffer, std::size_t i) const {
+    return ilha.arena.data() + (static_cast<std::size_t>(buffer) * ilha.size + i) * words;
 }
 
-void AlgoritmoGenetico::select_parents() {
-    std::sort(populacao.begin(), populacao.end(), [](const std::vector<int>& a, const std::vector<int>& b) {
-        return std::count(a.begin(), a.end(), 1) > std::count(b.begin(), b.end(), 1);
+std::size_t AlgoritmoGenetico::elite_count(const Ilha& ilha) const {
+    return std::min(ilha.size, static_cast<std::size_t>(elitism));
+}
+
+void AlgoritmoGenetico::inicialize_popular(Ilha& ilha, std::size_t size) {
+    ilha.size = size;
+    ilha.current = 0;
+    ilha.arena.assign(2 * size * words, 0);
+    ilha.fitness.assign(size, 0.0);
+    ilha.views.assign(size, GenomaView{nullptr, genome_length});
+    ilha.order.resize(size);
+    ilha.parents.assign(2 * ((size - elite_count(ilha) + 1) / 2), 0);
+    ilha.arrivals.assign(static_cast<std::size_t>(migrants), Individuo());
+    for (Individuo& arriving : ilha.arrivals) arriving.genes.assign(words, 0);
+    ilha.outgoing.genes.assign(words, 0);
+    ilha.best.genes.clear();
+    ilha.best.genes.reserve(words);
+    ilha.evaluations = 0;
+    ilha.received = 0;
+
+    for_each_block(size, [&](std::size_t lo, std::size_t hi) {
+        for (std::size_t i = lo; i < hi; ++i) {
+            Xoshiro256 rng(seed, stream_id(PHASE_INIT, 0, ilha.id), i);
+            std::uint64_t* genes = genome(ilha, 0, i);
+            for (std::size_t w = 0; w < words; ++w) {
+                genes[w] = rng();
+            }
+            if (words > 0) genes[words - 1] &= tail_mask(genome_length);
+        }
     });
 }
 
-void AlgoritmoGenetico::crossover() {
-    std::uniform_int_distribution<int> dist(0, 9);
-    for (size_t i = 0; i < popular_size; i += 2) {
-        int crossover_point = dist(rng);
-        std::vector<int> parent1 = populacao[i];
-        std::vector<int> parent2 = populacao[i + 1];
-        for (int j = crossover_point; j < 10; ++j) {
-            std::swap(parent1[j], parent2[j]);
+void AlgoritmoGenetico::evaluate_popular(Ilha& ilha) {
+    for (std::size_t i = 0; i < ilha.size; ++i) ilha.views[i].words = genome(ilha, ilha.current, i);
+    for_each_block(ilha.size, [&](std::size_t lo, std::size_t hi) {
+        if (batch_fitness_function) {
+            batch_fitness_function(ilha.views.data() + lo, hi - lo, ilha.fitness.data() + lo);
+        } else {
+            for (std::size_t i = lo; i < hi; ++i) {
+                ilha.fitness[i] = fitness_function(ilha.views[i]);
+            }
+        }
+    });
+    ilha.evaluations += ilha.size;
+
+    // Melhor em ordem de índice: o primeiro entre empatados, como no sequencial
+    for (std::size_t i = 0; i < ilha.size; ++i) {
+        if (ilha.best.genes.empty() || ilha.fitness[i] > ilha.best.fitness) {
+            ilha.best.genes.assign(ilha.views[i].words, ilha.views[i].words + words);
+            ilha.best.fitness = ilha.fitness[i];
         }
-        populacao[i] = parent1;
-        populacao[i+1] = parent2;
     }
 }
 
-void AlgoritmoGenetico::mutate() {
-    std::uniform_int_distribution<int> dist(0, 9);
-    std::uniform_real_distribution<double> prob_dist(0.0, 1.0);
-    for (auto& individual : populacao) {
-        for (auto& gene : individual) {
-            if (prob_dist(rng) < 0.01) {
-                gene = !gene;
+// Deixa em order[0, count) os count melhores da geração atual, sem ordenar o resto
+void AlgoritmoGenetico::rank_best(Ilha& ilha, std::size_t count) {
+    for (std::size_t i = 0; i < ilha.size; ++i) ilha.order[i] = static_cast<std::uint32_t>(i);
+    if (count == 0 || count >= ilha.size) return;
+    const std::vector<double>& fitness = ilha.fitness;
+    std::nth_element(ilha.order.begin(), ilha.order.begin() + (count - 1), ilha.order.end(),
+                     [&](std::uint32_t a, std::uint32_t b) {
+                         return fitness[a] > fitness[b] || (fitness[a] == fitness[b] && a < b);
+                     });
+}
+
+void AlgoritmoGenetico::select_parents(Ilha& ilha, int generation) {
+    // Elitismo: os melhores passam intactos para o início do próximo buffer
+    std::size_t elites = elite_count(ilha);
+    rank_best(ilha, elites);
+    int next = 1 - ilha.current;
+    for (std::size_t e = 0; e < elites; ++e) {
+        const std::uint64_t* source = genome(ilha, ilha.current, ilha.order[e]);
+        std::copy(source, source + words, genome(ilha, next, e));
+    }
+
+    // Torneio: o melhor entre tournament_size sorteados, dois por par de filhos
+    std::size_t tournament = static_cast<std::size_t>(std::max(1, tournament_size));
+    for_each_block(ilha.parents.size() / 2, [&](std::size_t lo, std::size_t hi) {
+        for (std::size_t pair = lo; pair < hi; ++pair) {
+            Xoshiro256 rng(seed, stream_id(PHASE_SELECTION, generation, ilha.id), pair);
+            for (std::size_t side = 0; side < 2; ++side) {
+                std::size_t winner = static_cast<std::size_t>(rng.below(ilha.size));
+                for (std::size_t round = 1; round < tournament; ++round) {
+                    std::size_t rival = static_cast<std::size_t>(rng.below(ilha.size));
+                    if (ilha.fitness[rival] > ilha.fitness[winner]) winner = rival;
+                }
+                ilha.parents[2 * pair + side] = static_cast<std::uint32_t>(winner);
             }
         }
+    });
+}
+
+void AlgoritmoGenetico::crossover(Ilha& ilha, int generation) {
+    std::size_t elites = elite_count(ilha);
+    int next = 1 - ilha.current;
+    // Cada par gera dois filhos direto no próximo buffer; com número ímpar
+    // de vagas o último par gera um só
+    for_each_block(ilha.parents.size() / 2, [&](std::size_t lo, std::size_t hi) {
+        for (std::size_t pair = lo; pair < hi; ++pair) {
+            Xoshiro256 rng(seed, stream_id(PHASE_CROSSOVER, generation, ilha.id), pair);
+            std::size_t crossover_point = genome_length > 0 ? static_cast<std::size_t>(rng.below(genome_length)) : 0;
+            const std::uint64_t* parent1 = genome(ilha, ilha.current, ilha.parents[2 * pair]);
+            const std::uint64_t* parent2 = genome(ilha, ilha.current, ilha.parents[2 * pair + 1]);
+            std::size_t slot = elites + 2 * pair;
+            // Filho 1: início do pai 1 e fim do pai 2; filho 2 ao contrário
+            std::size_t w = crossover_point / WORD_BITS;
+            std::uint64_t high = ~std::uint64_t(0) << (crossover_point % WORD_BITS);
+            for (std::size_t child = 0; child < 2 && slot + child < ilha.size; ++child) {
+                const std::uint64_t* head = child == 0 ? parent1 : parent2;
+                const std::uint64_t* tail = child == 0 ? parent2 : parent1;
+                std::uint64_t* out = genome(ilha, next, slot + child);
+                if (words == 0) continue;
+                std::copy(head, head + w, out);
+                out[w] = (head[w] & ~high) | (tail[w] & high);
+                std::copy(tail + w + 1, tail + words, out + w + 1);
+            }
+        }
+    });
+}
+
+void AlgoritmoGenetico::mutate(Ilha& ilha, int generation) {
+    std::size_t elites = elite_count(ilha);
+    int next = 1 - ilha.current;
+    if (mutation_rate > 0.0 && genome_length > 0) {
+        // A distância até o próximo bit mutado é geométrica: só se sorteia um
+        // número por mutação, e não um por gene. Os elites não mudam
+        double log_keep = std::log1p(-std::min(mutation_rate, 1.0));
+        for_each_block(ilha.size - elites, [&](std::size_t lo, std::size_t hi) {
+            for (std::size_t i = elites + lo; i < elites + hi; ++i) {
+                Xoshiro256 rng(seed, stream_id(PHASE_MUTATION, generation, ilha.id), i);
+                std::uint64_t* genes = genome(ilha, next, i);
+                std::size_t gene = 0;
+                while (true) {
+                    if (mutation_rate < 1.0) {
+                        double skip = std::floor(std::log(1.0 - rng.uniform()) / log_keep);
+                        if (skip >= static_cast<double>(genome_length - gene)) break;
+                        gene += static_cast<std::size_t>(skip);
+                    }
+                    if (gene >= genome_length) break;
+                    genes[gene / WORD_BITS] ^= std::uint64_t(1) << (gene % WORD_BITS);
+                    ++gene;
+                }
+            }
+        });
     }
+    // A próxima geração passa a ser a atual
+    ilha.current = next;
+}
+
+void AlgoritmoGenetico::emigrate(Ilha& ilha, SpscQueue<Individuo>& target, std::size_t count) {
+    // Cópias dos melhores; a fila cheia descarta o excesso
+    count = std::min(count, ilha.size);
+    rank_best(ilha, count);
+    for (std::size_t m = 0; m < count; ++m) {
+        const std::uint64_t* source = genome(ilha, ilha.current, ilha.order[m]);
+        std::copy(source, source + words, ilha.outgoing.genes.begin());
+        ilha.outgoing.fitness = ilha.fitness[ilha.order[m]];
+        target.try_push(ilha.outgoing);
+    }
+}
+
+void AlgoritmoGenetico::immigrate(Ilha& ilha, SpscQueue<Individuo>* const* sources, std::size_t source_count,
+                                  std::size_t limit) {
+    // Recebe o que já chegou, sem esperar
+    limit = std::min(limit, ilha.size);
+    std::size_t arrived = 0;
+    for (std::size_t s = 0; s < source_count && arrived < limit; ++s) {
+        while (arrived < limit && sources[s]->try_pop(ilha.arrivals[arrived])) ++arrived;
+    }
+    if (arrived == 0) return;
+    // Os recém-chegados substituem os piores
+    rank_best(ilha, ilha.size - arrived);
+    for (std::size_t a = 0; a < arrived; ++a) {
+        std::uint32_t worst = ilha.order[ilha.size - 1 - a];
+        std::copy(ilha.arrivals[a].genes.begin(), ilha.arrivals[a].genes.end(), genome(ilha, ilha.current, worst));
+        ilha.fitness[worst] = ilha.arrivals[a].fitness;
+    }
+    ilha.received += arrived;
 }
 
 void AlgoritmoGenetico::run() {
-    inicialize_popular();
-    for (int i = 0; i < generations; ++i)
+    // Nenhuma ilha fica vazia: com mais ilhas que indivíduos, uma por indivíduo
+    int active = std::min(islands, popular_size);
+    if (active > 1) {
+        run_islands(static_cast<std::size_t>(active));
+        std::cout << "Algoritmo Genético concluído (" << active << " ilhas)." << std::endl;
+        return;
+    }
+    Ilha ilha;
+    inicialize_popular(ilha, popular_size);
+    for (int generation = 0; generation < generations; ++generation)
     {
-        evaluate_popular();
-        select_parents();
-        crossover();
-        mutate();
+        evaluate_popular(ilha);
+        select_parents(ilha, generation);
+        crossover(ilha, generation);
+        mutate(ilha, generation);
     }
+    evaluate_popular(ilha);
+    best = ilha.best;
+    evaluations = ilha.evaluations;
+    migrants_received = 0;
     std::cout << "Algoritmo Genético concluído." << std::endl;
-}
\ No newline at end of file
+}
+
+void AlgoritmoGenetico::run_islands(std::size_t k) {
+    std::vector<Ilha> ilhas(k);
+    // Uma fila por par (origem, destino): cada fila tem um só produtor e um
+    // só consumidor. Capacidade para duas levas, o excesso é descartado
+    std::vector<std::unique_ptr<SpscQueue<Individuo>>> queues(k * k);
+    for (auto& queue : queues) queue.reset(new SpscQueue<Individuo>(2 * static_cast<std::size_t>(migrants)));
+
+    auto evolve = [&](std::size_t index) {
+        Ilha& ilha = ilhas[index];
+        ilha.id = index;
+        // Tamanhos diferem em no máximo um indivíduo
+        std::size_t total = static_cast<std::size_t>(popular_size);
+        std::size_t size = total / k + (index < total % k ? 1 : 0);
+        inicialize_popular(ilha, size);
+        std::vector<SpscQueue<Individuo>*> incoming;
+        for (std::size_t from = 0; from < k; ++from) {
+            if (from != index) incoming.push_back(queues[from * k + index].get());
+        }
+
+        for (int generation = 0; generation < generations; ++generation) {
+            evaluate_popular(ilha);
+            immigrate(ilha, incoming.data(), incoming.size(), static_cast<std::size_t>(migrants));
+            if (migration_interval > 0 && migrants > 0 && (generation + 1) % migration_interval == 0) {
+                std::size_t target = (index + 1) % k;
+                if (topology == MigrationTopology::Random) {
+                    Xoshiro256 rng(seed, stream_id(PHASE_MIGRATION, generation, ilha.id), 0);
+                    target = (index + 1 + rng.below(k - 1)) % k;
+                }
+                emigrate(ilha, *queues[index * k + target], static_cast<std::size_t>(migrants));
+            }
+            select_parents(ilha, generation);
+            crossover(ilha, generation);
+            mutate(ilha, generation);
+        }
+        evaluate_popular(ilha);
+    };
+
+    std::vector<std::thread> threads;
+    for (std::size_t i = 1; i < k; ++i) threads.emplace_back(evolve, i);
+    evolve(0);
+    for (auto& thread : threads) thread.join();
+
+    best = Individuo();
+    evaluations = 0;
+    migrants_received = 0;
+    for (const Ilha& ilha : ilhas) {
+        if (best.genes.empty() || ilha.best.fitness > best.fitness) best = ilha.best;
+        evaluations += ilha.evaluations;
+        migrants_received += ilha.received;
+    }
+}
+
+const std::vector<std::uint64_t>& AlgoritmoGenetico::get_best_solution() const {
+    return best.genes;
+}
+
+double AlgoritmoGenetico::get_best_fitness() const {
+    return best.fitness;
+}
+
+std::size_t AlgoritmoGenetico::get_genome_length() const {
+    return genome_length;
+}
+
+std::size_t AlgoritmoGenetico::get_evaluations() const {
+    return evaluations;
+}
+
+std::size_t AlgoritmoGenetico::get_migrants_received() const {
+    return migrants_received;
+}
+
+void AlgoritmoGenetico::set_thread_pool(ThreadPool* thread_pool) {
+    pool = thread_pool;
+}
+
+void AlgoritmoGenetico::set_seed(std::uint64_t new_seed) {
+    seed = new_seed;
+}
+
+void AlgoritmoGenetico::set_island_model(int num_islands, int interval, int num_migrants, MigrationTopology migration_topology) {
+    if (num_islands > MAX_ISLANDS) {
+        throw std::invalid_argument("Algoritmo genético: no máximo 65535 ilhas");
+    }
+    islands = std::max(1, num_islands);
+    migration_interval = std::max(0, interval);
+    migrants = std::max(0, num_migrants);
+    topology = migration_topology;
+}
+
+void AlgoritmoGenetico::set_tournament_size(int size) {
+    tournament_size = std::max(1, size);
+}
+
+void AlgoritmoGenetico::set_elitism(int count) {
+    elitism = std::max(0, count);
+}
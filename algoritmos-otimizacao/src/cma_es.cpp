@@ -0,0 +1,376 @@
+#include "cma_es.h"
+#include "xoshiro.h"
+#include <iostream>
+#include <ctime>
+#include <cmath>
+#include <algorithm>
+#include <limits>
+#include <iomanip>
+
+namespace {
+
+// Par de normais padrão pelo método polar de Marsaglia; sem <random>,
+// cujas distribuições mudam de biblioteca para biblioteca
+void gaussian_pair(Xoshiro256& rng, double& first, double& second) {
+    double u, v, s;
+    do {
+        u = 2.0 * rng.uniform() - 1.0;
+        v = 2.0 * rng.uniform() - 1.0;
+        s = u * u + v * v;
+    } while (s >= 1.0 || s == 0.0);
+    double factor = std::sqrt(-2.0 * std::log(s) / s);
+    first = u * factor;
+    second = v * factor;
+}
+
+// Autovalores e autovetores de a (n x n, simétrica) por Jacobi cíclico:
+// cada rotação zera um elemento fora da diagonal, e as varreduras repetem
+// até o que sobra fora dela ser desprezível. a é destruída; vectors
+// recebe os autovetores nas colunas
+void jacobi_eigen(std::vector<double>& a, int n, std::vector<double>& values, std::vector<double>& vectors) {
+    vectors.assign(static_cast<std::size_t>(n) * n, 0.0);
+    for (int i = 0; i < n; ++i) vectors[i * n + i] = 1.0;
+
+    for (int sweep = 0; sweep < 64; ++sweep) {
+        double off = 0.0, diagonal = 0.0;
+        for (int p = 0; p < n; ++p) {
+            diagonal += a[p * n + p] * a[p * n + p];
+            for (int q = p + 1; q < n; ++q) off += a[p * n + q] * a[p * n + q];
+        }
+        if (off <= 1e-30 * diagonal || off == 0.0) break;
+
+        for (int p = 0; p < n; ++p) {
+            for (int q = p + 1; q < n; ++q) {
+                double apq = a[p * n + q];
+                if (apq == 0.0) continue;
+                // Rotação J no plano (p, q) com (J^T A J)[p][q] = 0
+                double theta = (a[q * n + q] - a[p * n + p]) / (2.0 * apq);
+                double t = (theta >= 0 ? 1.0 : -1.0) / (std::fabs(theta) + std::sqrt(theta * theta + 1.0));
+                double c = 1.0 / std::sqrt(t * t + 1.0);
+                double s = t * c;
+                for (int k = 0; k < n; ++k) {
+                    double akp = a[k * n + p], akq = a[k * n + q];
+                    a[k * n + p] = c * akp - s * akq;
+                    a[k * n + q] = s * akp + c * akq;
+                }
+                for (int k = 0; k < n; ++k) {
+                    double apk = a[p * n + k], aqk = a[q * n + k];
+                    a[p * n + k] = c * apk - s * aqk;
+                    a[q * n + k] = s * apk + c * aqk;
+                }
+                for (int k = 0; k < n; ++k) {
+                    double vkp = vectors[k * n + p], vkq = vectors[k * n + q];
+                    vectors[k * n + p] = c * vkp - s * vkq;
+                    vectors[k * n + q] = s * vkp + c * vkq;
+                }
+            }
+        }
+    }
+    values.resize(n);
+    for (int i = 0; i < n; ++i) values[i] = a[i * n + i];
+}
+
+}
+
+CMAEvolutionStrategy::CMAEvolutionStrategy(
+    int dimensions, int max_evaluations,
+    std::function<double(const std::vector<double>&)> fitness_func,
+    double min_bound, double max_bound)
+    : fitness_function(fitness_func), dimensions(dimensions),
+      max_evaluations(max_evaluations), min_bound(min_bound), max_bound(max_bound),
+      target_fitness(-std::numeric_limits<double>::infinity()),
+      initial_sigma(0.25 * (max_bound - min_bound)),
+      initial_lambda(4 + static_cast<int>(3.0 * std::log(static_cast<double>(dimensions)))),
+      max_restarts(9), seed(static_cast<std::uint64_t>(std::time(nullptr))),
+      best_solution(dimensions), best_fitness(std::numeric_limits<double>::max()),
+      evaluations(0), restarts(0), candidate(dimensions) {}
+
+void CMAEvolutionStrategy::initialize_run(int population, Xoshiro256& rng) {
+    const int n = dimensions;
+    const double N = static_cast<double>(n);
+
+    // Pesos logarítmicos dos mu melhores (Hansen, "The CMA Evolution Strategy: A Tutorial")
+    lambda = population;
+    mu = lambda / 2;
+    weights.resize(mu);
+    for (int i = 0; i < mu; ++i) weights[i] = std::log(mu + 0.5) - std::log(i + 1.0);
+    double sum = 0.0, sum_squares = 0.0;
+    for (double w : weights) sum += w;
+    for (double& w : weights) {
+        w /= sum;
+        sum_squares += w * w;
+    }
+    mueff = 1.0 / sum_squares;
+
+    cc = (4.0 + mueff / N) / (N + 4.0 + 2.0 * mueff / N);
+    cs = (mueff + 2.0) / (N + mueff + 5.0);
+    c1 = 2.0 / ((N + 1.3) * (N + 1.3) + mueff);
+    cmu = std::min(1.0 - c1, 2.0 * (mueff - 2.0 + 1.0 / mueff) / ((N + 2.0) * (N + 2.0) + mueff));
+    damps = 1.0 + 2.0 * std::max(0.0, std::sqrt((mueff - 1.0) / (N + 1.0)) - 1.0) + cs;
+    chi_n = std::sqrt(N) * (1.0 - 1.0 / (4.0 * N) + 1.0 / (21.0 * N * N));
+
+    mean.resize(n);
+    for (double& m : mean) m = min_bound + (max_bound - min_bound) * rng.uniform();
+    sigma = start_sigma = initial_sigma;
+    pc.assign(n, 0.0);
+    ps.assign(n, 0.0);
+    C.assign(static_cast<std::size_t>(n) * n, 0.0);
+    B.assign(static_cast<std::size_t>(n) * n, 0.0);
+    D.assign(n, 1.0);
+    for (int i = 0; i < n; ++i) C[i * n + i] = B[i * n + i] = 1.0;
+    eigen_evaluation = evaluations;
+
+    arz.resize(static_cast<std::size_t>(lambda) * n);
+    ary.resize(static_cast<std::size_t>(lambda) * n);
+    arx.resize(static_cast<std::size_t>(lambda) * n);
+    y_mean.resize(n);
+    whitened.resize(n);
+    fitness.resize(lambda);
+    order.resize(lambda);
+    history.clear();
+}
+
+double CMAEvolutionStrategy::evaluate(const double* x) {
+    // Avalia a projeção na caixa; a distância até ela vira penalidade
+    double penalty = 0.0;
+    for (int i = 0; i < dimensions; ++i) {
+        candidate[i] = std::clamp(x[i], min_bound, max_bound);
+        penalty += (x[i] - candidate[i]) * (x[i] - candidate[i]);
+    }
+    double value = fitness_function(candidate);
+    ++evaluations;
+    if (value < best_fitness) {
+        best_fitness = value;
+        best_solution = candidate;
+    }
+    return value + penalty;
+}
+
+bool CMAEvolutionStrategy::finished() const {
+    return evaluations >= max_evaluations || best_fitness <= target_fitness;
+}
+
+// Sorteia e avalia a geração; false se o orçamento ou o alvo a interromperam
+bool CMAEvolutionStrategy::sample_and_evaluate(Xoshiro256& rng) {
+    const int n = dimensions;
+    for (int k = 0; k < lambda; ++k) {
+        double* z = &arz[static_cast<std::size_t>(k) * n];
+        double* y = &ary[static_cast<std::size_t>(k) * n];
+        double* x = &arx[static_cast<std::size_t>(k) * n];
+        for (int i = 0; i + 1 < n; i += 2) gaussian_pair(rng, z[i], z[i + 1]);
+        if (n % 2 == 1) {
+            double unused;
+            gaussian_pair(rng, z[n - 1], unused);
+        }
+        // y = B D z ~ N(0, C), x = m + sigma y
+        for (int i = 0; i < n; ++i) {
+            double sum = 0.0;
+            for (int j = 0; j < n; ++j) sum += B[i * n + j] * D[j] * z[j];
+            y[i] = sum;
+            x[i] = mean[i] + sigma * sum;
+        }
+    }
+    for (int k = 0; k < lambda; ++k) {
+        if (finished()) return false;
+        fitness[k] = evaluate(&arx[static_cast<std::size_t>(k) * n]);
+    }
+    return true;
+}
+
+void CMAEvolutionStrategy::update_distribution(int generation) {
+    const int n = dimensions;
+    for (int k = 0; k < lambda; ++k) order[k] = k;
+    std::sort(order.begin(), order.end(), [&](int a, int b) { return fitness[a] < fitness[b]; });
+
+    // Nova média: passo médio ponderado dos mu melhores
+    std::fill(y_mean.begin(), y_mean.end(), 0.0);
+    for (int r = 0; r < mu; ++r) {
+        const double* y = &ary[static_cast<std::size_t>(order[r]) * n];
+        for (int i = 0; i < n; ++i) y_mean[i] += weights[r] * y[i];
+    }
+    for (int i = 0; i < n; ++i) mean[i] += sigma * y_mean[i];
+
+    // ps acumula C^(-1/2) y_mean = B D^(-1) B^T y_mean
+    for (int j = 0; j < n; ++j) {
+        double sum = 0.0;
+        for (int i = 0; i < n; ++i) sum += B[i * n + j] * y_mean[i];
+        whitened[j] = sum / D[j];
+    }
+    double ps_scale = std::sqrt(cs * (2.0 - cs) * mueff);
+    double ps_norm = 0.0;
+    for (int i = 0; i < n; ++i) {
+        double sum = 0.0;
+        for (int j = 0; j < n; ++j) sum += B[i * n + j] * whitened[j];
+        ps[i] = (1.0 - cs) * ps[i] + ps_scale * sum;
+        ps_norm += ps[i] * ps[i];
+    }
+    ps_norm = std::sqrt(ps_norm);
+
+    // hsig segura pc quando ps está longo demais (passo ainda crescendo)
+    bool hsig = ps_norm / std::sqrt(1.0 - std::pow(1.0 - cs, 2.0 * generation)) / chi_n <
+                1.4 + 2.0 / (n + 1.0);
+    double pc_scale = hsig ? std::sqrt(cc * (2.0 - cc) * mueff) : 0.0;
+    for (int i = 0; i < n; ++i) pc[i] = (1.0 - cc) * pc[i] + pc_scale * y_mean[i];
+
+    // C: rank-one (pc pc^T) + rank-mu (passos dos mu melhores); só o
+    // triângulo superior, espelhado na decomposição
+    double keep = 1.0 - c1 - cmu + (hsig ? 0.0 : c1 * cc * (2.0 - cc));
+    for (int i = 0; i < n; ++i) {
+        for (int j = i; j < n; ++j) {
+            double rank_mu = 0.0;
+            for (int r = 0; r < mu; ++r) {
+                const double* y = &ary[static_cast<std::size_t>(order[r]) * n];
+                rank_mu += weights[r] * y[i] * y[j];
+            }
+            C[i * n + j] = keep * C[i * n + j] + c1 * pc[i] * pc[j] + cmu * rank_mu;
+        }
+    }
+
+    sigma *= std::exp((cs / damps) * (ps_norm / chi_n - 1.0));
+
+    // Decomposição preguiçosa: C muda pouco por geração
+    if (evaluations - eigen_evaluation > lambda / (c1 + cmu) / n / 10.0) update_eigensystem();
+}
+
+void CMAEvolutionStrategy::update_eigensystem() {
+    const int n = dimensions;
+    eigen_evaluation = evaluations;
+    for (int i = 0; i < n; ++i) {
+        for (int j = 0; j < i; ++j) C[i * n + j] = C[j * n + i];
+    }
+    // C mudou pouco desde a última decomposição: na base antiga, B^T C B
+    // é quase diagonal e Jacobi converge em uma ou duas varreduras.
+    // Os autovetores de C são B vezes os desta matriz
+    std::vector<double> CB(static_cast<std::size_t>(n) * n, 0.0), work(static_cast<std::size_t>(n) * n, 0.0);
+    for (int i = 0; i < n; ++i) {
+        for (int k = 0; k < n; ++k) {
+            double cik = C[i * n + k];
+            for (int j = 0; j < n; ++j) CB[i * n + j] += cik * B[k * n + j];
+        }
+    }
+    for (int k = 0; k < n; ++k) {
+        for (int i = 0; i < n; ++i) {
+            double bki = B[k * n + i];
+            for (int j = 0; j < n; ++j) work[i * n + j] += bki * CB[k * n + j];
+        }
+    }
+    std::vector<double> values, rotation;
+    jacobi_eigen(work, n, values, rotation);
+    std::fill(CB.begin(), CB.end(), 0.0);
+    for (int i = 0; i < n; ++i) {
+        for (int k = 0; k < n; ++k) {
+            double bik = B[i * n + k];
+            for (int j = 0; j < n; ++j) CB[i * n + j] += bik * rotation[k * n + j];
+        }
+    }
+    B.swap(CB);
+    for (int i = 0; i < n; ++i) D[i] = std::sqrt(std::max(values[i], 1e-300));
+}
+
+bool CMAEvolutionStrategy::should_restart(int generation, int max_generations) const {
+    const int n = dimensions;
+    if (generation >= max_generations) return true;
+
+    // Fitness plano: a geração e o histórico recente não distinguem nada
+    double best = fitness[order[0]];
+    if (best == fitness[order[std::min(lambda - 1, (7 * lambda + 9) / 10)]]) return true;
+    if (history.size() >= static_cast<std::size_t>(10 + 30 * n / lambda)) {
+        auto range = std::minmax_element(history.begin(), history.end());
+        double spread = std::max(*range.second, best) - std::min(*range.first, best);
+        if (spread < 1e-12) return true;
+    }
+
+    // Passo desprezível em todas as coordenadas
+    bool tiny = true;
+    for (int i = 0; i < n && tiny; ++i) {
+        tiny = sigma * std::max(std::fabs(pc[i]), std::sqrt(C[i * n + i])) < 1e-12 * start_sigma;
+    }
+    if (tiny) return true;
+
+    // C mal condicionada ou passo explodindo
+    double d_min = *std::min_element(D.begin(), D.end());
+    double d_max = *std::max_element(D.begin(), D.end());
+    if (d_max > 1e7 * d_min) return true;
+    return sigma * d_max > 1e4 * start_sigma;
+}
+
+void CMAEvolutionStrategy::run() {
+    std::cout << "Iniciando CMA-ES..." << std::endl;
+    std::cout << "Dimensões: " << dimensions << ", Avaliações: " << max_evaluations
+              << ", Limites: [" << min_bound << ", " << max_bound << "]" << std::endl;
+
+    best_fitness = std::numeric_limits<double>::max();
+    evaluations = 0;
+    restarts = 0;
+    Xoshiro256 rng(seed);
+    int population = initial_lambda;
+
+    while (true) {
+        initialize_run(population, rng);
+        int max_generations = 100 + static_cast<int>(150.0 * (dimensions + 3) * (dimensions + 3) / std::sqrt(lambda));
+        int generation = 0;
+        while (sample_and_evaluate(rng)) {
+            update_distribution(++generation);
+            if (should_restart(generation, max_generations)) break;
+            history.push_back(fitness[order[0]]);
+            if (history.size() > static_cast<std::size_t>(10 + 30 * dimensions / lambda)) {
+                history.erase(history.begin());
+            }
+        }
+        if (finished() || restarts >= max_restarts) break;
+        // IPOP: recomeça com o dobro da população
+        ++restarts;
+        population *= 2;
+    }
+
+    std::cout << "Total de avaliações: " << evaluations << ", reinícios: " << restarts << std::endl;
+    std::cout << "CMA-ES concluído." << std::endl;
+}
+
+std::vector<double> CMAEvolutionStrategy::get_best_solution() const {
+    return best_solution;
+}
+
+double CMAEvolutionStrategy::get_best_fitness() const {
+    return best_fitness;
+}
+
+int CMAEvolutionStrategy::get_evaluations() const {
+    return evaluations;
+}
+
+int CMAEvolutionStrategy::get_restarts() const {
+    return restarts;
+}
+
+void CMAEvolutionStrategy::set_target_fitness(double target) {
+    target_fitness = target;
+}
+
+void CMAEvolutionStrategy::set_initial_sigma(double sigma) {
+    initial_sigma = sigma;
+}
+
+void CMAEvolutionStrategy::set_population_size(int population) {
+    initial_lambda = std::max(4, population);
+}
+
+void CMAEvolutionStrategy::set_max_restarts(int count) {
+    max_restarts = std::max(0, count);
+}
+
+void CMAEvolutionStrategy::set_seed(std::uint64_t new_seed) {
+    seed = new_seed;
+}
+
+void CMAEvolutionStrategy::print_results() const {
+    std::cout << "\n=== RESULTADOS FINAIS ===" << std::endl;
+    std::cout << "Melhor fitness encontrado: " << std::fixed << std::setprecision(8)
+              << best_fitness << std::endl;
+    std::cout << "Melhor solução encontrada: [";
+    for (size_t i = 0; i < best_solution.size(); ++i) {
+        std::cout << std::fixed << std::setprecision(4) << best_solution[i];
+        if (i < best_solution.size() - 1) std::cout << ", ";
+    }
+    std::cout << "]" << std::endl;
+}
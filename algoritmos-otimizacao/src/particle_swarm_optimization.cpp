@@ -1,17 +1,21 @@
 #include "particle_swarm_optimization.h"
+#include "xoshiro.h"
 #include <iostream>
-#include <random>
 #include <ctime>
 #include <algorithm>
 #include <limits>
 #include <iomanip>
 
-std::mt19937 pso_rng(static_cast<unsigned int>(std::time(nullptr)));
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
 
-Particle::Particle(int dimensions)
-    : position(dimensions), velocity(dimensions), best_position(dimensions),
-      fitness(std::numeric_limits<double>::max()),
-      best_fitness(std::numeric_limits<double>::max()) {}
+namespace {
+
+// Limite de velocidade para evitar explosão
+const double MAX_VELOCITY = 2.0;
+
+}
 
 ParticleSwarmOptimization::ParticleSwarmOptimization(
     int num_particles, int dimensions, int max_iterations,
@@ -20,89 +24,113 @@ ParticleSwarmOptimization::ParticleSwarmOptimization(
     : num_particles(num_particles), dimensions(dimensions),
       max_iterations(max_iterations), min_bound(min_bound), max_bound(max_bound),
       inertia_weight(0.9), cognitive_coef(2.0), social_coef(2.0),
-      global_best_position(dimensions),
-      global_best_fitness(std::numeric_limits<double>::max()),
-      fitness_function(fitness_func) {
+      seed(static_cast<std::uint64_t>(std::time(nullptr))),
+      stride((static_cast<std::size_t>(dimensions) + 3) / 4 * 4),
+      positions(num_particles * stride), velocities(num_particles * stride),
+      best_positions(num_particles * stride),
+      fitness(num_particles, std::numeric_limits<double>::max()),
+      best_fitness(num_particles, std::numeric_limits<double>::max()),
+      candidate(dimensions), global_best(-1),
+      fitness_function(fitness_func) {}
+
+double* ParticleSwarmOptimization::row(std::vector<double>& matrix, int particle) {
+    return matrix.data() + static_cast<std::size_t>(particle) * stride;
+}
 
-    swarm.reserve(num_particles);
-    for (int i = 0; i < num_particles; ++i) {
-        swarm.emplace_back(dimensions);
-    }
+const double* ParticleSwarmOptimization::row(const std::vector<double>& matrix, int particle) const {
+    return matrix.data() + static_cast<std::size_t>(particle) * stride;
 }
 
 void ParticleSwarmOptimization::initialize_swarm() {
-    std::uniform_real_distribution<double> pos_dist(min_bound, max_bound);
-    std::uniform_real_distribution<double> vel_dist(-1.0, 1.0);
-
-    for (auto& particle : swarm) {
+    // As colunas de preenchimento (além de dimensions) começam em zero e
+    // nunca chegam à função de fitness
+    std::fill(positions.begin(), positions.end(), 0.0);
+    std::fill(velocities.begin(), velocities.end(), 0.0);
+    std::fill(fitness.begin(), fitness.end(), std::numeric_limits<double>::max());
+    std::fill(best_fitness.begin(), best_fitness.end(), std::numeric_limits<double>::max());
+    global_best = -1;
+
+    for (int p = 0; p < num_particles; ++p) {
+        Xoshiro256 rng(seed, 0, static_cast<std::uint64_t>(p));
+        double* x = row(positions, p);
+        double* v = row(velocities, p);
         for (int i = 0; i < dimensions; ++i) {
-            particle.position[i] = pos_dist(pso_rng);
-            particle.velocity[i] = vel_dist(pso_rng);
+            x[i] = min_bound + (max_bound - min_bound) * rng.uniform();
+            v[i] = 2.0 * rng.uniform() - 1.0;
         }
-        particle.best_position = particle.position;
     }
+    best_positions = positions;
 }
 
 void ParticleSwarmOptimization::evaluate_fitness() {
-    for (auto& particle : swarm) {
-        particle.fitness = fitness_function(particle.position);
+    for (int p = 0; p < num_particles; ++p) {
+        const double* x = row(positions, p);
+        std::copy(x, x + dimensions, candidate.begin());
+        fitness[p] = fitness_function(candidate);
     }
 }
 
 void ParticleSwarmOptimization::update_personal_best() {
-    for (auto& particle : swarm) {
-        if (particle.fitness < particle.best_fitness) {
-            particle.best_fitness = particle.fitness;
-            particle.best_position = particle.position;
+    for (int p = 0; p < num_particles; ++p) {
+        if (fitness[p] < best_fitness[p]) {
+            best_fitness[p] = fitness[p];
+            const double* x = row(positions, p);
+            std::copy(x, x + stride, row(best_positions, p));
         }
     }
 }
 
 void ParticleSwarmOptimization::update_global_best() {
-    for (const auto& particle : swarm) {
-        if (particle.best_fitness < global_best_fitness) {
-            global_best_fitness = particle.best_fitness;
-            global_best_position = particle.best_position;
-        }
-    }
-}
-
-void ParticleSwarmOptimization::update_velocities() {
-    std::uniform_real_distribution<double> rand_dist(0.0, 1.0);
-
-    for (auto& particle : swarm) {
-        for (int i = 0; i < dimensions; ++i) {
-            double r1 = rand_dist(pso_rng);
-            double r2 = rand_dist(pso_rng);
-
-            double cognitive_component = cognitive_coef * r1 *
-                (particle.best_position[i] - particle.position[i]);
-            double social_component = social_coef * r2 *
-                (global_best_position[i] - particle.position[i]);
-
-            particle.velocity[i] = inertia_weight * particle.velocity[i] +
-                cognitive_component + social_component;
-
-            // Limitar velocidade para evitar explosão
-            particle.velocity[i] = std::clamp(particle.velocity[i], -2.0, 2.0);
+    // As melhores posições pessoais só melhoram: basta apontar para a melhor delas
+    for (int p = 0; p < num_particles; ++p) {
+        if (global_best < 0 || best_fitness[p] < best_fitness[global_best]) {
+            global_best = p;
         }
     }
 }
 
-void ParticleSwarmOptimization::update_positions() {
-    for (auto& particle : swarm) {
-        for (int i = 0; i < dimensions; ++i) {
-            particle.position[i] += particle.velocity[i];
+// Velocidade, posição e limites numa só passada por partícula
+void ParticleSwarmOptimization::update_swarm(int iteration) {
+    if (global_best < 0) return;  // enxame vazio
+    const double* global = row(best_positions, global_best);
+    for (int p = 0; p < num_particles; ++p) {
+        Xoshiro256x4 rng(seed, static_cast<std::uint64_t>(iteration) + 1, static_cast<std::uint64_t>(p));
+        double* x = row(positions, p);
+        double* v = row(velocities, p);
+        const double* personal = row(best_positions, p);
+#ifdef __AVX2__
+        const __m256d w = _mm256_set1_pd(inertia_weight);
+        const __m256d c1 = _mm256_set1_pd(cognitive_coef);
+        const __m256d c2 = _mm256_set1_pd(social_coef);
+        const __m256d v_lo = _mm256_set1_pd(-MAX_VELOCITY), v_hi = _mm256_set1_pd(MAX_VELOCITY);
+        const __m256d x_lo = _mm256_set1_pd(min_bound), x_hi = _mm256_set1_pd(max_bound);
+        for (std::size_t j = 0; j < stride; j += 4) {
+            __m256d r1 = rng.uniform4();
+            __m256d r2 = rng.uniform4();
+            __m256d xj = _mm256_loadu_pd(x + j);
+            __m256d cognitive = _mm256_mul_pd(_mm256_mul_pd(c1, r1), _mm256_sub_pd(_mm256_loadu_pd(personal + j), xj));
+            __m256d social = _mm256_mul_pd(_mm256_mul_pd(c2, r2), _mm256_sub_pd(_mm256_loadu_pd(global + j), xj));
+            __m256d vj = _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(w, _mm256_loadu_pd(v + j)), cognitive), social);
+            vj = _mm256_min_pd(_mm256_max_pd(vj, v_lo), v_hi);
+            xj = _mm256_min_pd(_mm256_max_pd(_mm256_add_pd(xj, vj), x_lo), x_hi);
+            _mm256_storeu_pd(v + j, vj);
+            _mm256_storeu_pd(x + j, xj);
         }
-    }
-    clamp_positions();
-}
-
-void ParticleSwarmOptimization::clamp_positions() {
-    for (auto& particle : swarm) {
-        for (int i = 0; i < dimensions; ++i) {
-            particle.position[i] = std::clamp(particle.position[i], min_bound, max_bound);
+#else
+        double r1[4], r2[4];
+        for (std::size_t j = 0; j < stride; j += 4) {
+            rng.uniform4(r1);
+            rng.uniform4(r2);
+            for (std::size_t lane = 0; lane < 4; ++lane) {
+                std::size_t i = j + lane;
+                double cognitive_component = cognitive_coef * r1[lane] * (personal[i] - x[i]);
+                double social_component = social_coef * r2[lane] * (global[i] - x[i]);
+                v[i] = std::clamp(inertia_weight * v[i] + cognitive_component + social_component,
+                                  -MAX_VELOCITY, MAX_VELOCITY);
+                x[i] = std::clamp(x[i] + v[i], min_bound, max_bound);
+            }
         }
+#endif
     }
 }
 
@@ -113,6 +141,7 @@ void ParticleSwarmOptimization::run() {
     std::cout << "Limites: [" << min_bound << ", " << max_bound << "]" << std::endl;
     std::cout << "----------------------------------------" << std::endl;
 
+    inertia_weight = 0.9;
     initialize_swarm();
 
     for (int iteration = 0; iteration < max_iterations; ++iteration) {
@@ -124,11 +153,10 @@ void ParticleSwarmOptimization::run() {
         if (iteration % 10 == 0 || iteration == max_iterations - 1) {
             std::cout << "Iteração " << std::setw(3) << iteration
                       << " | Melhor fitness: " << std::fixed << std::setprecision(6)
-                      << global_best_fitness << std::endl;
+                      << get_best_fitness() << std::endl;
         }
 
-        update_velocities();
-        update_positions();
+        update_swarm(iteration);
 
         // Reduzir inércia ao longo do tempo
         inertia_weight = 0.9 - (0.5 * iteration / max_iterations);
@@ -139,17 +167,24 @@ void ParticleSwarmOptimization::run() {
 }
 
 std::vector<double> ParticleSwarmOptimization::get_best_solution() const {
-    return global_best_position;
+    if (global_best < 0) return std::vector<double>(dimensions, 0.0);
+    const double* best = row(best_positions, global_best);
+    return std::vector<double>(best, best + dimensions);
 }
 
 double ParticleSwarmOptimization::get_best_fitness() const {
-    return global_best_fitness;
+    return global_best < 0 ? std::numeric_limits<double>::max() : best_fitness[global_best];
+}
+
+void ParticleSwarmOptimization::set_seed(std::uint64_t new_seed) {
+    seed = new_seed;
 }
 
 void ParticleSwarmOptimization::print_results() const {
+    std::vector<double> global_best_position = get_best_solution();
     std::cout << "\n=== RESULTADOS FINAIS ===" << std::endl;
     std::cout << "Melhor fitness encontrado: " << std::fixed << std::setprecision(8)
-              << global_best_fitness << std::endl;
+              << get_best_fitness() << std::endl;
     std::cout << "Melhor solução encontrada: [";
     for (size_t i = 0; i < global_best_position.size(); ++i) {
         std::cout << std::fixed << std::setprecision(4) << global_best_position[i];
@@ -0,0 +1,29 @@
+#include <chrono>
+#include <iostream>
+#include <sstream>
+#include "algoritmo_genetico.h"
+
+using namespace std;
+
+// Qualidade por tempo: mesma população total e gerações, com e sem ilhas
+int main() {
+    const int POPULATION = 400, GENERATIONS = 300;
+    const size_t LENGTH = 4096;
+    cout << "OneMax de " << LENGTH << " bits, população " << POPULATION << ", " << GENERATIONS
+         << " gerações (migração de 4 a cada 10)" << endl;
+
+    for (int island_count : {1, 2, 4, 8}) {
+        AlgoritmoGenetico ga(POPULATION, GENERATIONS, LENGTH);
+        ga.set_seed(5);
+        ga.set_island_model(island_count, 10, 4);
+        ostringstream sink;
+        streambuf* previous = cout.rdbuf(sink.rdbuf());
+        auto start = chrono::steady_clock::now();
+        ga.run();
+        double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+        cout.rdbuf(previous);
+        cout << "  " << island_count << " ilha(s): melhor " << static_cast<size_t>(ga.get_best_fitness()) << " de "
+             << LENGTH << " em " << seconds << " s" << endl;
+    }
+    return 0;
+}
@@ -0,0 +1,130 @@
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "cma_es.h"
+#include "particle_swarm_optimization.h"
+#include "simulated_annealing.h"
+
+using namespace std;
+
+using Function = function<double(const vector<double>&)>;
+
+double sphere_function(const vector<double>& x) {
+    double sum = 0.0;
+    for (double val : x) sum += val * val;
+    return sum;
+}
+
+double rastrigin_function(const vector<double>& x) {
+    double sum = 10.0 * x.size();
+    for (double val : x) sum += val * val - 10.0 * cos(2.0 * M_PI * val);
+    return sum;
+}
+
+double rosenbrock_function(const vector<double>& x) {
+    double sum = 0.0;
+    for (size_t i = 0; i + 1 < x.size(); ++i) {
+        double term1 = x[i + 1] - x[i] * x[i];
+        double term2 = x[i] - 1.0;
+        sum += 100.0 * term1 * term1 + term2 * term2;
+    }
+    return sum;
+}
+
+double ackley_function(const vector<double>& x) {
+    double sum1 = 0.0, sum2 = 0.0;
+    for (double val : x) {
+        sum1 += val * val;
+        sum2 += cos(2.0 * M_PI * val);
+    }
+    double n = static_cast<double>(x.size());
+    return -20.0 * exp(-0.2 * sqrt(sum1 / n)) - exp(sum2 / n) + 20.0 + exp(1.0);
+}
+
+// Conta avaliações e guarda em qual delas o alvo foi atingido pela primeira vez
+struct EvaluationCounter {
+    Function function;
+    double target;
+    long evaluations = 0;
+    long hit = -1;
+
+    double operator()(const vector<double>& x) {
+        double value = function(x);
+        ++evaluations;
+        if (hit < 0 && value <= target) hit = evaluations;
+        return value;
+    }
+};
+
+struct Problem {
+    string name;
+    Function function;
+    double min_bound;
+    double max_bound;
+};
+
+// Avaliações até o alvo: mediana das execuções que chegaram lá
+string median_hits(vector<long> hits) {
+    hits.erase(remove(hits.begin(), hits.end(), -1L), hits.end());
+    if (hits.empty()) return "não atingiu";
+    sort(hits.begin(), hits.end());
+    return to_string(hits[hits.size() / 2]);
+}
+
+void compare(const Problem& problem, int dimensions, int budget, double target, int runs) {
+    vector<long> cma_hits, pso_hits, sa_hits;
+    for (int run = 0; run < runs; ++run) {
+        // Os otimizadores mostram o progresso em cout; aqui ele é descartado
+        ostringstream sink;
+        streambuf* previous = cout.rdbuf(sink.rdbuf());
+
+        EvaluationCounter cma_counter{problem.function, target};
+        CMAEvolutionStrategy cma(dimensions, budget, ref(cma_counter), problem.min_bound, problem.max_bound);
+        cma.set_target_fitness(target);
+        cma.set_seed(100 + run);
+        cma.run();
+        cma_hits.push_back(cma_counter.hit);
+
+        const int PARTICLES = 30;
+        EvaluationCounter pso_counter{problem.function, target};
+        ParticleSwarmOptimization pso(PARTICLES, dimensions, budget / PARTICLES, ref(pso_counter),
+                                      problem.min_bound, problem.max_bound);
+        pso.set_seed(100 + run);
+        pso.run();
+        pso_hits.push_back(pso_counter.hit);
+
+        EvaluationCounter sa_counter{problem.function, target};
+        SimulatedAnnealing sa(ref(sa_counter), dimensions, 100.0, 0.001, budget - 1, 0.95,
+                              problem.min_bound, problem.max_bound);
+        sa.set_step_size(0.5);
+        sa.run();
+        sa_hits.push_back(sa_counter.hit);
+
+        cout.rdbuf(previous);
+    }
+    cout << "  " << problem.name << " " << dimensions << "D: CMA-ES " << median_hits(cma_hits)
+         << " | PSO " << median_hits(pso_hits) << " | SA " << median_hits(sa_hits) << endl;
+}
+
+int main() {
+    const int BUDGET = 20000, RUNS = 5;
+    const double TARGET = 1e-6;
+    cout << "Avaliações até o alvo " << TARGET << " (orçamento de " << BUDGET << ", mediana de " << RUNS
+         << " execuções)" << endl;
+    // SimulatedAnnealing usa um gerador global semeado pelo relógio
+    cout << "CMA-ES e PSO com sementes fixas; os números do SA variam de uma execução para outra" << endl;
+
+    vector<Problem> problems = {
+        {"Esfera", sphere_function, -5.0, 5.0},
+        {"Rastrigin", rastrigin_function, -5.12, 5.12},
+        {"Rosenbrock", rosenbrock_function, -2.0, 2.0},
+        {"Ackley", ackley_function, -5.0, 5.0},
+    };
+    for (int dimensions : {2, 10}) {
+        for (const Problem& problem : problems) compare(problem, dimensions, BUDGET, TARGET, RUNS);
+    }
+    return 0;
+}
@@ -0,0 +1,121 @@
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <vector>
+#include "particle_swarm_optimization.h"
+
+using namespace std;
+
+double sphere_function(const vector<double>& x) {
+    double sum = 0.0;
+    for (double val : x) sum += val * val;
+    return sum;
+}
+
+// O enxame antigo: três vetores por partícula, uma passada por etapa,
+// mt19937 escalar e cópia do vetor inteiro quando o melhor global muda
+struct ReferenceSwarm {
+    struct Particle {
+        vector<double> position, velocity, best_position;
+        double fitness = numeric_limits<double>::max();
+        double best_fitness = numeric_limits<double>::max();
+        explicit Particle(int dimensions) : position(dimensions), velocity(dimensions), best_position(dimensions) {}
+    };
+
+    int dimensions;
+    vector<Particle> swarm;
+    vector<double> global_best_position;
+    double global_best_fitness = numeric_limits<double>::max();
+    mt19937 rng{1};
+
+    ReferenceSwarm(int particles, int dimensions) : dimensions(dimensions), global_best_position(dimensions) {
+        uniform_real_distribution<double> pos_dist(-10.0, 10.0), vel_dist(-1.0, 1.0);
+        for (int p = 0; p < particles; ++p) {
+            swarm.emplace_back(dimensions);
+            for (int i = 0; i < dimensions; ++i) {
+                swarm.back().position[i] = pos_dist(rng);
+                swarm.back().velocity[i] = vel_dist(rng);
+            }
+            swarm.back().best_position = swarm.back().position;
+        }
+    }
+
+    void iterate(double inertia_weight) {
+        for (auto& particle : swarm) particle.fitness = sphere_function(particle.position);
+        for (auto& particle : swarm) {
+            if (particle.fitness < particle.best_fitness) {
+                particle.best_fitness = particle.fitness;
+                particle.best_position = particle.position;
+            }
+        }
+        for (const auto& particle : swarm) {
+            if (particle.best_fitness < global_best_fitness) {
+                global_best_fitness = particle.best_fitness;
+                global_best_position = particle.best_position;
+            }
+        }
+        uniform_real_distribution<double> rand_dist(0.0, 1.0);
+        for (auto& particle : swarm) {
+            for (int i = 0; i < dimensions; ++i) {
+                double r1 = rand_dist(rng), r2 = rand_dist(rng);
+                particle.velocity[i] = clamp(inertia_weight * particle.velocity[i] +
+                                                 2.0 * r1 * (particle.best_position[i] - particle.position[i]) +
+                                                 2.0 * r2 * (global_best_position[i] - particle.position[i]),
+                                             -2.0, 2.0);
+            }
+        }
+        for (auto& particle : swarm) {
+            for (int i = 0; i < dimensions; ++i) particle.position[i] += particle.velocity[i];
+        }
+        for (auto& particle : swarm) {
+            for (int i = 0; i < dimensions; ++i) particle.position[i] = clamp(particle.position[i], -10.0, 10.0);
+        }
+    }
+};
+
+int main() {
+    const int PARTICLES = 10000, DIMENSIONS = 1000, ITERATIONS = 5;
+    cout << "PSO, " << PARTICLES << " partículas x " << DIMENSIONS << " dimensões, " << ITERATIONS
+         << " iterações (inclui avaliar a esfera)" << endl;
+#ifdef __AVX2__
+    cout << "Kernel: AVX2" << endl;
+#else
+    cout << "Kernel: escalar (compile com -mavx2 para o vetorial)" << endl;
+#endif
+
+    double reference_seconds;
+    {
+        ReferenceSwarm reference(PARTICLES, DIMENSIONS);
+        auto start = chrono::steady_clock::now();
+        for (int iteration = 0; iteration < ITERATIONS; ++iteration) reference.iterate(0.9);
+        reference_seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    }
+
+    double soa_seconds;
+    {
+        // Só a inicialização é descontada: uma execução de 0 iterações
+        ParticleSwarmOptimization empty(PARTICLES, DIMENSIONS, 0, sphere_function);
+        ParticleSwarmOptimization pso(PARTICLES, DIMENSIONS, ITERATIONS, sphere_function);
+        empty.set_seed(1);
+        pso.set_seed(1);
+        ostringstream sink;
+        streambuf* previous = cout.rdbuf(sink.rdbuf());
+        auto start = chrono::steady_clock::now();
+        empty.run();
+        double setup = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+        start = chrono::steady_clock::now();
+        pso.run();
+        soa_seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count() - setup;
+        cout.rdbuf(previous);
+    }
+
+    cout << fixed << setprecision(1);
+    cout << "  vetores por partícula: " << ITERATIONS / reference_seconds << " iterações/s" << endl;
+    cout << "  matrizes contíguas:    " << ITERATIONS / soa_seconds << " iterações/s ("
+         << setprecision(2) << reference_seconds / soa_seconds << "x)" << endl;
+    return 0;
+}
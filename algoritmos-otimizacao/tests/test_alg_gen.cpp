@@ -1,5 +1,73 @@
+#include <atomic>
+#include <cstdlib>
 #include <iostream>
+#include <new>
+#include <stdexcept>
+#include <string>
 #include "algoritmo_genetico.h"
+#include "thread_pool.h"
+#include "teste.h"
+
+// Conta as alocações do programa inteiro, para medir as de uma execução
+std::atomic<std::size_t> allocations{0};
+
+void* operator new(std::size_t size) {
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size == 0 ? 1 : size)) return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+// Fitness OneMax recontado bit a bit a partir do genoma empacotado
+std::size_t count_ones(const std::vector<std::uint64_t>& genes, std::size_t genome_length) {
+    std::size_t ones = 0;
+    for (std::size_t i = 0; i < genome_length; ++i) {
+        ones += (genes[i / 64] >> (i % 64)) & 1;
+    }
+    return ones;
+}
+
+// Nenhum bit acima do comprimento pode estar ligado
+bool tail_is_clear(const std::vector<std::uint64_t>& genes, std::size_t genome_length) {
+    for (std::size_t i = genome_length; i < genes.size() * 64; ++i) {
+        if ((genes[i / 64] >> (i % 64)) & 1) return false;
+    }
+    return true;
+}
+
+// Quantos genes em sequência, a partir do início, são 1
+double leading_ones(const GenomaView& genome) {
+    std::size_t count = 0;
+    while (count < genome.length && genome.gene(count)) ++count;
+    return static_cast<double>(count);
+}
+
+// Alocações feitas por uma execução panmítica sem pool
+std::size_t allocations_for(int generations) {
+    AlgoritmoGenetico ga(50, generations, 1000);
+    ga.set_seed(17);
+    ga.set_tournament_size(3);
+    ga.set_elitism(2);
+    std::size_t before = allocations.load();
+    ga.run();
+    return allocations.load() - before;
+}
+
+struct RunResult {
+    std::vector<std::uint64_t> best;
+    double fitness;
+};
+
+RunResult run_with_threads(unsigned threads, std::uint64_t seed) {
+    ThreadPool pool(threads);
+    AlgoritmoGenetico ga(61, 40, 300, leading_ones);
+    ga.set_seed(seed);
+    ga.set_thread_pool(&pool);
+    ga.run();
+    return {ga.get_best_solution(), ga.get_best_fitness()};
+}
 
 int main() {
     
@@ -8,8 +76,113 @@ int main() {
 
     AlgoritmoGenetico ga(populacao_size, generations);
     ga.run();
+    check(ga.get_genome_length() == 10 && ga.get_best_fitness() <= 10 &&
+              count_ones(ga.get_best_solution(), 10) == ga.get_best_fitness(),
+          "genoma padrão de 10 bits: fitness = bits 1 do melhor (" + std::to_string(static_cast<std::size_t>(ga.get_best_fitness())) + ")");
 
-    std::cout << "Teste concluído" << std::endl;
-    
-    return 0;
-}
\ No newline at end of file
+    // Comprimento que não é múltiplo de 64 e população ímpar
+    AlgoritmoGenetico odd(51, 200, 1000);
+    odd.run();
+    const std::vector<std::uint64_t>& best = odd.get_best_solution();
+    check(best.size() == 16 && tail_is_clear(best, 1000) && count_ones(best, 1000) == odd.get_best_fitness(),
+          "1000 bits em 16 palavras, sem bits além do comprimento");
+    check(odd.get_best_fitness() > 500,
+          "melhor acima da média de um genoma aleatório: " + std::to_string(static_cast<std::size_t>(odd.get_best_fitness())) + " de 1000 bits");
+
+    // Genomas de milhões de bits
+    std::size_t length = 4000000;
+    AlgoritmoGenetico large(20, 5, length, 1.0 / length);
+    large.run();
+    check(large.get_best_solution().size() == length / 64 &&
+              count_ones(large.get_best_solution(), length) == large.get_best_fitness(),
+          "genoma de 4 milhões de bits: fitness por popcount confere");
+
+    AlgoritmoGenetico all_flip(4, 1, 130, 1.0);
+    all_flip.run();
+    check(tail_is_clear(all_flip.get_best_solution(), 130), "taxa de mutação 1 inverte só os bits do genoma");
+
+    // Fitness configurável: LeadingOnes
+    AlgoritmoGenetico custom(40, 100, 64, leading_ones);
+    custom.set_seed(7);
+    custom.run();
+    check(custom.get_best_fitness() == leading_ones(GenomaView{custom.get_best_solution().data(), 64}) &&
+              custom.get_evaluations() == 40 * 101,
+          "fitness configurável (LeadingOnes) e 40 * 101 avaliações");
+
+    // Fitness em lote: recebe um bloco de genomas por chamada
+    std::size_t batch_calls = 0;
+    AlgoritmoGenetico batched(32, 10, 100, AlgoritmoGenetico::BatchFitnessFunction(
+        [&](const GenomaView* genomes, std::size_t count, double* fitness) {
+            ++batch_calls;
+            for (std::size_t i = 0; i < count; ++i) fitness[i] = static_cast<double>(genomes[i].count_ones());
+        }));
+    batched.set_seed(7);
+    batched.run();
+    AlgoritmoGenetico single(32, 10, 100);
+    single.set_seed(7);
+    single.run();
+    check(batch_calls == 11 && batched.get_best_solution() == single.get_best_solution(),
+          "fitness em lote: uma chamada por geração, mesmo resultado do OneMax por indivíduo");
+
+    // Reproduzível com qualquer número de threads
+    RunResult one = run_with_threads(1, 2024);
+    RunResult two = run_with_threads(2, 2024);
+    RunResult four = run_with_threads(4, 2024);
+    RunResult other = run_with_threads(4, 2025);
+    check(one.best == two.best && one.best == four.best && one.fitness == four.fitness,
+          "mesma semente com 1, 2 e 4 threads: mesmo melhor indivíduo");
+    check(other.best != one.best, "semente diferente, execução diferente");
+
+    // Modelo de ilhas
+    AlgoritmoGenetico ring(200, 60, 512);
+    ring.set_seed(11);
+    ring.set_island_model(4, 5, 2, MigrationTopology::Ring);
+    ring.run();
+    check(ring.get_migrants_received() > 0 && ring.get_evaluations() == 200 * 61 &&
+              count_ones(ring.get_best_solution(), 512) == ring.get_best_fitness(),
+          "4 ilhas em anel: migrantes recebidos (" + std::to_string(ring.get_migrants_received()) +
+              "), 200 * 61 avaliações no total");
+
+    AlgoritmoGenetico random_topology(201, 60, 512);
+    random_topology.set_island_model(3, 4, 3, MigrationTopology::Random);
+    random_topology.run();
+    check(random_topology.get_migrants_received() > 0 && random_topology.get_evaluations() == 201 * 61,
+          "3 ilhas com destino sorteado e população ímpar");
+
+    AlgoritmoGenetico panmictic(64, 30, 200);
+    panmictic.set_seed(3);
+    panmictic.run();
+    AlgoritmoGenetico one_island(64, 30, 200);
+    one_island.set_seed(3);
+    one_island.set_island_model(1, 5, 2);
+    one_island.run();
+    check(panmictic.get_best_solution() == one_island.get_best_solution() && one_island.get_migrants_received() == 0,
+          "uma ilha só é a população única");
+
+    // Mais ilhas que indivíduos: nenhuma ilha vazia (genes vazios, fitness 0) vence
+    auto zeros = [](const GenomaView& genome) { return -static_cast<double>(genome.count_ones()); };
+    AlgoritmoGenetico crowded(2, 5, 64, zeros);
+    crowded.set_seed(9);
+    crowded.set_island_model(4, 1, 1);
+    crowded.run();
+    check(crowded.get_best_solution().size() == 1 &&
+              -static_cast<double>(count_ones(crowded.get_best_solution(), 64)) == crowded.get_best_fitness(),
+          "4 ilhas para 2 indivíduos: o melhor é um indivíduo de verdade");
+
+    // Os fluxos aleatórios reservam 16 bits para a ilha
+    bool too_many = false;
+    try {
+        crowded.set_island_model(0x10000, 1, 1);
+    } catch (const std::invalid_argument&) {
+        too_many = true;
+    }
+    crowded.set_island_model(0xFFFF, 1, 1);
+    check(too_many, "mais de 65535 ilhas lança invalid_argument");
+
+    std::size_t short_run = allocations_for(10);
+    std::size_t long_run = allocations_for(60);
+    check(short_run == long_run, "nenhuma alocação por geração: " + std::to_string(short_run) + " com 10 e " +
+                                     std::to_string(long_run) + " com 60 gerações");
+
+    return test_summary("Teste concluído");
+}
@@ -0,0 +1,121 @@
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "cma_es.h"
+#include "teste.h"
+
+// Função de teste 1: Esfera (mínimo global em [0,0,...,0] = 0)
+double sphere_function(const std::vector<double>& x) {
+    double sum = 0.0;
+    for (double val : x) {
+        sum += val * val;
+    }
+    return sum;
+}
+
+// Função de teste 2: Rastrigin (mínimo global em [0,0,...,0] = 0)
+double rastrigin_function(const std::vector<double>& x) {
+    double A = 10.0;
+    double sum = A * x.size();
+    for (double val : x) {
+        sum += val * val - A * std::cos(2.0 * M_PI * val);
+    }
+    return sum;
+}
+
+// Função de teste 3: Rosenbrock (mínimo global em [1,1,...,1] = 0)
+double rosenbrock_function(const std::vector<double>& x) {
+    double sum = 0.0;
+    for (size_t i = 0; i < x.size() - 1; ++i) {
+        double term1 = x[i+1] - x[i] * x[i];
+        double term2 = x[i] - 1.0;
+        sum += 100.0 * term1 * term1 + term2 * term2;
+    }
+    return sum;
+}
+
+// Função de teste 4: Ackley (mínimo global em [0,0,...,0] = 0)
+double ackley_function(const std::vector<double>& x) {
+    double a = 20.0;
+    double b = 0.2;
+    double c = 2.0 * M_PI;
+
+    double sum1 = 0.0;
+    double sum2 = 0.0;
+
+    for (double val : x) {
+        sum1 += val * val;
+        sum2 += std::cos(c * val);
+    }
+
+    double n = static_cast<double>(x.size());
+    return -a * std::exp(-b * std::sqrt(sum1 / n)) - std::exp(sum2 / n) + a + std::exp(1.0);
+}
+
+using Function = std::function<double(const std::vector<double>&)>;
+
+// CMA-ES mostra o progresso em std::cout; nos testes ele é descartado
+struct SilentOutput {
+    std::ostringstream sink;
+    std::streambuf* previous;
+    SilentOutput() : previous(std::cout.rdbuf(sink.rdbuf())) {}
+    ~SilentOutput() { std::cout.rdbuf(previous); }
+};
+
+CMAEvolutionStrategy run_cma(int dimensions, int budget, Function func, double min_bound, double max_bound,
+                             double target, std::uint64_t seed) {
+    CMAEvolutionStrategy cma(dimensions, budget, func, min_bound, max_bound);
+    cma.set_target_fitness(target);
+    cma.set_seed(seed);
+    SilentOutput silent;
+    cma.run();
+    return cma;
+}
+
+int main() {
+    const double TARGET = 1e-8;
+
+    CMAEvolutionStrategy sphere = run_cma(10, 20000, sphere_function, -5.0, 5.0, TARGET, 1);
+    check(sphere.get_best_fitness() <= TARGET && sphere.get_restarts() == 0,
+          "esfera 10D: alvo em " + std::to_string(sphere.get_evaluations()) + " avaliações, sem reinício");
+
+    CMAEvolutionStrategy rosenbrock = run_cma(10, 100000, rosenbrock_function, -2.0, 2.0, TARGET, 2);
+    std::vector<double> x = rosenbrock.get_best_solution();
+    check(rosenbrock.get_best_fitness() <= TARGET && std::fabs(x[0] - 1.0) < 1e-3 && std::fabs(x[9] - 1.0) < 1e-3,
+          "Rosenbrock 10D: vale seguido até [1,...,1] em " + std::to_string(rosenbrock.get_evaluations()) +
+              " avaliações");
+
+    CMAEvolutionStrategy ackley = run_cma(10, 100000, ackley_function, -5.0, 5.0, TARGET, 3);
+    check(ackley.get_best_fitness() <= TARGET,
+          "Ackley 10D: alvo em " + std::to_string(ackley.get_evaluations()) + " avaliações");
+
+    CMAEvolutionStrategy rastrigin = run_cma(5, 300000, rastrigin_function, -5.12, 5.12, TARGET, 4);
+    check(rastrigin.get_best_fitness() <= TARGET,
+          "Rastrigin 5D: mínimo global com IPOP após " + std::to_string(rastrigin.get_restarts()) +
+              " reinício(s), " + std::to_string(rastrigin.get_evaluations()) + " avaliações");
+
+    // Mínimo fora da caixa: a melhor solução fica na borda e nunca além dela
+    auto shifted = [](const std::vector<double>& v) {
+        double sum = 0.0;
+        for (double val : v) sum += (val - 7.0) * (val - 7.0);
+        return sum;
+    };
+    CMAEvolutionStrategy bounded = run_cma(4, 5000, shifted, -5.0, 5.0, -1.0, 5);
+    std::vector<double> edge = bounded.get_best_solution();
+    bool inside = std::all_of(edge.begin(), edge.end(), [](double v) { return v >= -5.0 && v <= 5.0; });
+    check(inside && std::fabs(bounded.get_best_fitness() - 16.0) < 1e-6 && bounded.get_evaluations() == 5000,
+          "limites respeitados: melhor na borda (fitness 16) sem passar de 5000 avaliações");
+
+    CMAEvolutionStrategy again = run_cma(10, 20000, sphere_function, -5.0, 5.0, TARGET, 1);
+    check(again.get_best_solution() == sphere.get_best_solution() && again.get_evaluations() == sphere.get_evaluations(),
+          "mesma semente, mesma execução");
+
+    // Dimensão alta: a decomposição preguiçosa mantém o custo por geração em O(lambda N^2)
+    CMAEvolutionStrategy high = run_cma(40, 200000, sphere_function, -5.0, 5.0, TARGET, 6);
+    check(high.get_best_fitness() <= TARGET, "esfera 40D: alvo em " + std::to_string(high.get_evaluations()) + " avaliações");
+
+    return test_summary("Teste concluído");
+}
@@ -1,6 +1,10 @@
 #include <iostream>
 #include <cmath>
+#include <sstream>
+#include <string>
 #include "particle_swarm_optimization.h"
+#include "xoshiro.h"
+#include "teste.h"
 
 // Função de teste 1: Esfera (mínimo global em [0,0,...,0] = 0)
 double sphere_function(const std::vector<double>& x) {
@@ -44,10 +48,76 @@ void test_function(const std::string& name,
     pso.print_results();
 }
 
+// Executa sem mostrar o progresso
+ParticleSwarmOptimization run_quiet(int particles, int dimensions, int iterations,
+                                    std::function<double(const std::vector<double>&)> func,
+                                    double min_bound, double max_bound, std::uint64_t seed) {
+    ParticleSwarmOptimization pso(particles, dimensions, iterations, func, min_bound, max_bound);
+    pso.set_seed(seed);
+    std::ostringstream sink;
+    std::streambuf* previous = std::cout.rdbuf(sink.rdbuf());
+    pso.run();
+    std::cout.rdbuf(previous);
+    return pso;
+}
+
 int main() {
     std::cout << "TESTES DO ALGORITMO PARTICLE SWARM OPTIMIZATION" << std::endl;
     std::cout << std::string(60, '=') << std::endl;
 
+    // Xoshiro256x4: o caminho AVX2 e o escalar dão a mesma sequência
+    Xoshiro256x4 vector_rng(42, 7, 3), scalar_rng(42, 7, 3);
+    bool same_sequence = true, in_range = true;
+    for (int step = 0; step < 1000; ++step) {
+        double expected[4], got[4];
+        scalar_rng.uniform4(expected);
+#ifdef __AVX2__
+        _mm256_storeu_pd(got, vector_rng.uniform4());
+#else
+        vector_rng.uniform4(got);
+#endif
+        for (int lane = 0; lane < 4; ++lane) {
+            same_sequence = same_sequence && got[lane] == expected[lane];
+            in_range = in_range && expected[lane] >= 0.0 && expected[lane] < 1.0;
+        }
+    }
+    check(same_sequence && in_range, "Xoshiro256x4: lanes vetoriais iguais às escalares, em [0, 1)");
+
+    // 13 dimensões: a última linha de 4 tem preenchimento
+    ParticleSwarmOptimization first = run_quiet(40, 13, 300, sphere_function, -5.0, 5.0, 9);
+    ParticleSwarmOptimization second = run_quiet(40, 13, 300, sphere_function, -5.0, 5.0, 9);
+    check(first.get_best_solution() == second.get_best_solution() && first.get_best_solution().size() == 13,
+          "mesma semente, mesmo enxame");
+    check(first.get_best_fitness() < 1e-3 && sphere_function(first.get_best_solution()) == first.get_best_fitness(),
+          "esfera 13D: melhor global confere com a posição guardada");
+
+    // Segunda execução do mesmo objeto: recomeça do zero, inércia inclusive
+    ParticleSwarmOptimization twice(40, 13, 300, sphere_function, -5.0, 5.0);
+    twice.set_seed(9);
+    {
+        std::ostringstream sink;
+        std::streambuf* previous = std::cout.rdbuf(sink.rdbuf());
+        twice.run();
+        twice.run();
+        std::cout.rdbuf(previous);
+    }
+    check(twice.get_best_solution() == first.get_best_solution(), "run() duas vezes: mesmo resultado da primeira");
+
+    ParticleSwarmOptimization empty = run_quiet(0, 5, 10, sphere_function, -5.0, 5.0, 1);
+    check(empty.get_best_solution().size() == 5, "enxame vazio roda sem partícula melhor");
+
+    // Mínimo fora da caixa: as posições são limitadas na mesma passada
+    auto shifted = [](const std::vector<double>& x) {
+        double sum = 0.0;
+        for (double val : x) sum += (val - 7.0) * (val - 7.0);
+        return sum;
+    };
+    ParticleSwarmOptimization bounded = run_quiet(30, 6, 100, shifted, -5.0, 5.0, 3);
+    std::vector<double> edge = bounded.get_best_solution();
+    bool inside = true;
+    for (double val : edge) inside = inside && val >= -5.0 && val <= 5.0;
+    check(inside && std::fabs(bounded.get_best_fitness() - 24.0) < 1e-9, "limites: melhor na borda da caixa");
+
     // Teste 1: Função Esfera
     test_function("Esfera", sphere_function);
 
@@ -58,8 +128,8 @@ int main() {
     test_function("Rosenbrock", rosenbrock_function, -2.0, 2.0);
 
     std::cout << "\n" << std::string(60, '=') << std::endl;
-    std::cout << "TODOS OS TESTES CONCLUÍDOS!" << std::endl;
+    int status = test_summary("TODOS OS TESTES CONCLUÍDOS!");
     std::cout << std::string(60, '=') << std::endl;
 
-    return 0;
+    return status;
 }
@@ -0,0 +1,50 @@
+#ifndef BUSCA_BINARIA_H
+#define BUSCA_BINARIA_H
+
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+/**
+ * Busca binária sem desvios (branchless lower_bound)
+ *
+ * Objetivo:
+ *   binarySearch (binary-search.cpp) decide a cada passo entre duas
+ *   metades com um if: em vetores grandes o processador erra metade
+ *   das previsões e cada erro descarta o trabalho especulativo. Aqui o
+ *   laço sempre faz o mesmo número de passos (ceil(log2 n)) e a escolha
+ *   vira aritmética,
+ *       base += (base[half - 1] < key) * half
+ *   que o compilador traduz para cmov: não há o que prever. Como o
+ *   próximo acesso depende da comparação, os dois candidatos (meio da
+ *   metade esquerda e da direita) são pedidos com prefetch antes de
+ *   comparar, e a latência de memória de um passo sobrepõe a do outro.
+ *
+ *   Índices são size_t: funciona para vetores com mais de 2^31 chaves.
+ *
+ * Complexidade:
+ *   - Tempo: O(log n), sem erros de previsão
+ *   - Espaço: O(1)
+ */
+
+// Primeira posição i com !(data[i] < key), ou n se não houver
+template <typename T, typename Compare = std::less<T>>
+std::size_t branchless_lower_bound(const T* data, std::size_t n, const T& key, Compare comp = Compare()) {
+    if (n == 0) return 0;
+    const T* base = data;
+    while (n > 1) {
+        std::size_t half = n / 2;
+        n -= half;
+        __builtin_prefetch(base + n / 2);
+        __builtin_prefetch(base + half + n / 2);
+        base += comp(base[half - 1], key) * half;
+    }
+    return static_cast<std::size_t>(base - data) + comp(*base, key);
+}
+
+template <typename T, typename Compare = std::less<T>>
+std::size_t branchless_lower_bound(const std::vector<T>& data, const T& key, Compare comp = Compare()) {
+    return branchless_lower_bound(data.data(), data.size(), key, comp);
+}
+
+#endif
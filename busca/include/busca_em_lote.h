@@ -0,0 +1,111 @@
+#ifndef BUSCA_EM_LOTE_H
+#define BUSCA_EM_LOTE_H
+
+#include "busca_binaria.h"
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include <vector>
+
+/**
+ * Busca binária em lote (muitas chaves de uma vez)
+ *
+ * Objetivo:
+ *   Uma busca isolada em vetor grande passa a maior parte do tempo
+ *   esperando a memória: cada passo depende da linha de cache pedida no
+ *   passo anterior. Com milhares de chaves por requisição, as buscas são
+ *   independentes entre si e essa espera pode ser sobreposta.
+ *
+ *   - batch_lower_bound: prefetch em grupo. BATCH_GROUP buscas andam
+ *     juntas, um passo de cada por vez: enquanto a linha pedida pela
+ *     busca j chega, as outras fazem seu passo e pedem as suas. Como
+ *     todas percorrem o mesmo vetor, fazem o mesmo número de passos e o
+ *     laço não tem desvios além do contador.
+ *   - sorted_batch_lower_bound: para consultas já ordenadas, a resposta
+ *     de uma é limite inferior para a próxima. A busca começa na posição
+ *     anterior com galope (passos 1, 2, 4, ...) e termina com
+ *     branchless_lower_bound só na janela encontrada; consultas próximas
+ *     custam O(1) e o vetor é lido quase em ordem.
+ *
+ *   Entrada e saída são ponteiro + tamanho (o projeto compila em C++17,
+ *   sem std::span): positions[i] recebe o lower_bound de queries[i].
+ *   EytzingerIndex::lower_bound_batch faz o mesmo sobre o layout de
+ *   Eytzinger.
+ *
+ * Complexidade:
+ *   - batch: O(count log n), com até BATCH_GROUP faltas de cache em voo
+ *   - ordenado: O(count + soma de log(distância entre respostas
+ *     consecutivas)), no máximo O(count log(n / count)) por consulta
+ */
+
+// Buscas intercaladas por grupo: o bastante para encher os buffers de falta de cache do núcleo
+const std::size_t BATCH_GROUP = 16;
+
+template <typename T, typename Compare = std::less<T>>
+void batch_lower_bound(const T* data, std::size_t n, const T* queries, std::size_t count, std::size_t* positions,
+                       Compare comp = Compare()) {
+    if (n == 0) {
+        std::fill(positions, positions + count, std::size_t(0));
+        return;
+    }
+    const T* base[BATCH_GROUP];
+    for (std::size_t first = 0; first < count; first += BATCH_GROUP) {
+        std::size_t group = std::min(BATCH_GROUP, count - first);
+        const T* keys = queries + first;
+        for (std::size_t j = 0; j < group; ++j) base[j] = data;
+
+        std::size_t length = n;
+        while (length > 1) {
+            std::size_t half = length / 2;
+            length -= half;
+            for (std::size_t j = 0; j < group; ++j) {
+                base[j] += comp(base[j][half - 1], keys[j]) * half;
+                __builtin_prefetch(base[j] + length / 2);
+            }
+        }
+        for (std::size_t j = 0; j < group; ++j) {
+            positions[first + j] = static_cast<std::size_t>(base[j] - data) + comp(*base[j], keys[j]);
+        }
+    }
+}
+
+// queries em ordem crescente (segundo comp)
+template <typename T, typename Compare = std::less<T>>
+void sorted_batch_lower_bound(const T* data, std::size_t n, const T* queries, std::size_t count,
+                              std::size_t* positions, Compare comp = Compare()) {
+    std::size_t previous = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+        const T& key = queries[i];
+        if (i > 0 && comp(key, queries[i - 1])) {
+            throw std::invalid_argument("sorted_batch_lower_bound: consultas fora de ordem");
+        }
+        // Galope a partir da resposta anterior: data[previous + step - 1] < key
+        std::size_t lo = previous, step = 1;
+        while (lo + step <= n && comp(data[lo + step - 1], key)) {
+            lo += step;
+            step *= 2;
+        }
+        std::size_t hi = std::min(n, lo + step - 1);
+        previous = lo + branchless_lower_bound(data + lo, hi - lo, key, comp);
+        positions[i] = previous;
+    }
+}
+
+template <typename T, typename Compare = std::less<T>>
+std::vector<std::size_t> batch_lower_bound(const std::vector<T>& data, const std::vector<T>& queries,
+                                           Compare comp = Compare()) {
+    std::vector<std::size_t> positions(queries.size());
+    batch_lower_bound(data.data(), data.size(), queries.data(), queries.size(), positions.data(), comp);
+    return positions;
+}
+
+template <typename T, typename Compare = std::less<T>>
+std::vector<std::size_t> sorted_batch_lower_bound(const std::vector<T>& data, const std::vector<T>& queries,
+                                                  Compare comp = Compare()) {
+    std::vector<std::size_t> positions(queries.size());
+    sorted_batch_lower_bound(data.data(), data.size(), queries.data(), queries.size(), positions.data(), comp);
+    return positions;
+}
+
+#endif
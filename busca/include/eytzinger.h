@@ -0,0 +1,139 @@
+#ifndef EYTZINGER_H
+#define EYTZINGER_H
+
+#include "memoria_alinhada.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * Índice de busca no layout de Eytzinger
+ *
+ * Objetivo:
+ *   Em um vetor ordenado os primeiros passos da busca binária pulam
+ *   para posições distantes (n/2, n/4, 3n/4...), cada uma numa linha de
+ *   cache diferente e sem relação com as anteriores. O layout de
+ *   Eytzinger guarda as chaves na ordem de uma travessia em largura da
+ *   árvore de busca implícita: a raiz em tree[1] e os filhos de k em
+ *   2k e 2k + 1. Os níveis de cima ficam juntos no começo do vetor (e
+ *   quentes no cache) e a busca desce com
+ *       k = 2k + (tree[k] < key)
+ *   sem desvios. Os 16 descendentes de k quatro níveis abaixo (chaves de
+ *   32 bits) são contíguos em [16k, 16k + 16) e, com o vetor alinhado a
+ *   64 bytes, ocupam exatamente uma linha: um prefetch dela a cada passo
+ *   esconde a latência de memória dos próximos quatro.
+ *
+ *   A construção não é recursiva: a posição ordenada (rank) de cada nó
+ *   sai em O(1) da geometria da árvore completa (rank_of), então
+ *   tree[k] = sorted[rank_of(k)] para cada k. A mesma fórmula converte o
+ *   nó encontrado pela busca de volta para a posição no vetor ordenado,
+ *   sem guardar um vetor de permutação.
+ *
+ *   Índices são size_t, para vetores com mais de 2^31 chaves.
+ *
+ * Complexidade:
+ *   - Construção: O(n)
+ *   - Busca: O(log n), uma linha de cache nova a cada ~4 níveis
+ *   - Espaço: n + 1 chaves
+ */
+
+template <typename T>
+class EytzingerIndex {
+public:
+    EytzingerIndex() = default;
+
+    // sorted deve estar em ordem crescente
+    explicit EytzingerIndex(const std::vector<T>& sorted) : EytzingerIndex(sorted.data(), sorted.size()) {}
+
+    EytzingerIndex(const T* sorted, std::size_t n) : n(n), tree(n + 1) {
+        levels = n > 0 ? 63 - static_cast<unsigned>(__builtin_clzll(n)) : 0;  // profundidade do último nível
+        for (std::size_t k = 1; k <= n; ++k) tree[k] = sorted[rank_of(k)];
+    }
+
+    std::size_t size() const { return n; }
+    std::size_t memory_bytes() const { return tree.bytes(); }
+
+    // Primeira posição i (no vetor ordenado) com !(sorted[i] < key), ou size()
+    std::size_t lower_bound(const T& key) const {
+        std::size_t k = descend(key);
+        return k == 0 ? n : rank_of(k);
+    }
+
+    // positions[i] = lower_bound(queries[i]); as buscas descem em grupos
+    // de GROUP, um nível de cada por vez, com as faltas de cache em paralelo
+    void lower_bound_batch(const T* queries, std::size_t count, std::size_t* positions) const {
+        const T* base = tree.data();
+        std::size_t node[GROUP];
+        for (std::size_t first = 0; first < count; first += GROUP) {
+            std::size_t group = count - first < GROUP ? count - first : GROUP;
+            const T* keys = queries + first;
+            for (std::size_t j = 0; j < group; ++j) node[j] = 1;
+            // Os níveis completos existem para todas as buscas
+            for (unsigned level = 0; level < levels; ++level) {
+                for (std::size_t j = 0; j < group; ++j) {
+                    std::size_t k = node[j];
+                    __builtin_prefetch(reinterpret_cast<const char*>(base) + k * BLOCK * sizeof(T));
+                    node[j] = 2 * k + (base[k] < keys[j]);
+                }
+            }
+            for (std::size_t j = 0; j < group; ++j) {
+                // No último nível, um nó ausente conta como passo à direita,
+                // que o deslocamento final desfaz
+                std::size_t k = node[j];
+                bool right = k > n || base[k <= n ? k : n] < keys[j];
+                k = 2 * k + right;
+                k >>= __builtin_ffsll(static_cast<long long>(~k));
+                positions[first + j] = k == 0 ? n : rank_of(k);
+            }
+        }
+    }
+
+    std::vector<std::size_t> lower_bound_batch(const std::vector<T>& queries) const {
+        std::vector<std::size_t> positions(queries.size());
+        lower_bound_batch(queries.data(), queries.size(), positions.data());
+        return positions;
+    }
+
+    bool contains(const T& key) const {
+        std::size_t k = descend(key);
+        return k != 0 && !(key < tree[k]);
+    }
+
+    // Posição ordenada do nó k (1 <= k <= size())
+    std::size_t rank_of(std::size_t k) const {
+        unsigned depth = 63 - static_cast<unsigned>(__builtin_clzll(k));
+        // Nós no último nível da árvore (o único possivelmente incompleto)
+        std::size_t last_level = n + 1 - (std::size_t(1) << levels);
+        if (depth == levels) return 2 * (k - (std::size_t(1) << levels));
+        // Rank entre os nós dos níveis completos, mais as folhas do último
+        // nível que vêm antes dele na ordem simétrica
+        std::size_t offset = k - (std::size_t(1) << depth);
+        std::size_t rank = ((2 * offset + 1) << (levels - 1 - depth)) - 1;
+        return rank + (rank + 1 < last_level ? rank + 1 : last_level);
+    }
+
+private:
+    // Chaves por linha de cache: os descendentes de k log2(BLOCK) níveis abaixo
+    static const std::size_t BLOCK = CACHE_LINE / sizeof(T) > 0 ? CACHE_LINE / sizeof(T) : 1;
+    // Buscas intercaladas em lower_bound_batch
+    static const std::size_t GROUP = 16;
+
+    std::size_t n = 0;
+    unsigned levels = 0;
+    AlignedArray<T> tree;  // tree[0] não é usado
+
+    // Nó da resposta (a última vez em que a busca foi para a esquerda), 0 se não houver
+    std::size_t descend(const T& key) const {
+        const T* base = tree.data();
+        std::size_t k = 1;
+        while (k <= n) {
+            __builtin_prefetch(reinterpret_cast<const char*>(base) + k * BLOCK * sizeof(T));
+            k = 2 * k + (base[k] < key);
+        }
+        // Desfaz os passos para a direita depois do último para a esquerda
+        k >>= __builtin_ffsll(static_cast<long long>(~k));
+        return k;
+    }
+};
+
+#endif
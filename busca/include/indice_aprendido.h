@@ -0,0 +1,214 @@
+#ifndef INDICE_APRENDIDO_H
+#define INDICE_APRENDIDO_H
+
+#include "busca_binaria.h"
+#include "memoria_alinhada.h"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * Índice aprendido (PGM): modelo linear por partes sobre o vetor ordenado
+ *
+ * Objetivo:
+ *   Em chaves quase uniformes (timestamps, IDs sequenciais) a posição
+ *   de uma chave é quase uma função linear dela. Em vez de buscar no
+ *   vetor inteiro como binarySearch, um modelo prevê a posição e a busca
+ *   final (branchless_lower_bound) olha só uma janela de ~2 epsilon
+ *   posições em volta da previsão.
+ *     - O modelo são segmentos (chave inicial, inclinação, posição
+ *       inicial). A construção percorre as chaves uma vez com o "cone"
+ *       de inclinações ainda válidas: cada ponto estreita o intervalo
+ *       de inclinações que mantêm todos os pontos do segmento a no
+ *       máximo epsilon posições da reta; quando ele fica vazio, o
+ *       segmento fecha e outro começa. Cada chave distinta entra com a
+ *       posição da sua primeira ocorrência.
+ *     - As chaves iniciais dos segmentos formam um vetor ordenado, que
+ *       recebe o mesmo tratamento (com RECURSIVE_EPSILON) até sobrar um
+ *       segmento só, como no PGM-index: a busca desce nível a nível,
+ *       cada um com uma janela pequena.
+ *   O índice não copia as chaves: guarda um ponteiro para o vetor
+ *   ordenado, que precisa continuar vivo e inalterado. memory_bytes()
+ *   conta só o que o índice acrescenta.
+ *
+ *   Garantia: para chaves distintas a resposta está na janela de
+ *   2 epsilon + 4 posições em volta da previsão (epsilon mais folga do
+ *   arredondamento). Se houver mais de epsilon repetições de uma chave e
+ *   a consulta cair logo depois dela, a janela pode não bastar; nesse
+ *   caso a busca continua por galope a partir da borda, sempre correta.
+ *
+ * Complexidade:
+ *   - Construção: O(n)
+ *   - Busca: O(níveis * log(RECURSIVE_EPSILON) + log(epsilon))
+ *   - Espaço: O(segmentos), poucos KB para milhões de chaves uniformes
+ */
+
+template <typename K>
+class PgmIndex {
+    static_assert(std::is_arithmetic<K>::value, "PgmIndex: chaves numéricas");
+
+public:
+    static const std::size_t DEFAULT_EPSILON = 64;
+    static const std::size_t RECURSIVE_EPSILON = 4;
+
+    struct Segment {
+        K key;             // primeira chave do segmento
+        double slope;      // posições por unidade de chave
+        double intercept;  // posição da primeira chave
+    };
+
+    PgmIndex() = default;
+
+    // sorted deve estar em ordem crescente e viver mais que o índice
+    explicit PgmIndex(const std::vector<K>& sorted, std::size_t epsilon = DEFAULT_EPSILON)
+        : PgmIndex(sorted.data(), sorted.size(), epsilon) {}
+
+    PgmIndex(const K* sorted, std::size_t n, std::size_t epsilon = DEFAULT_EPSILON)
+        : data(sorted), n(n), epsilon(epsilon) {
+        if (epsilon == 0) throw std::invalid_argument("PgmIndex: epsilon deve ser positivo");
+        if (n == 0) return;
+        levels.push_back(build_segments(sorted, n, epsilon));
+        while (levels.back().size() > 1) {
+            const std::vector<Segment>& below = levels.back();
+            std::vector<K> keys(below.size());
+            for (std::size_t i = 0; i < below.size(); ++i) keys[i] = below[i].key;
+            levels.push_back(build_segments(keys.data(), keys.size(), RECURSIVE_EPSILON));
+        }
+        std::reverse(levels.begin(), levels.end());  // levels[0] = raiz
+    }
+
+    std::size_t size() const { return n; }
+    std::size_t segments() const { return levels.empty() ? 0 : levels.back().size(); }
+    std::size_t height() const { return levels.size(); }
+
+    std::size_t memory_bytes() const {
+        std::size_t bytes = sizeof(*this) + levels.capacity() * sizeof(std::vector<Segment>);
+        for (const auto& level : levels) bytes += level.capacity() * sizeof(Segment);
+        return bytes;
+    }
+
+    // Janela [lo, hi) onde o modelo garante a resposta (chaves distintas)
+    std::pair<std::size_t, std::size_t> search_window(const K& key) const {
+        if (n == 0) return {0, 0};
+        // Desce pelos níveis internos: em cada um, o último segmento com chave <= key
+        std::size_t segment = 0;
+        for (std::size_t level = 0; level + 1 < levels.size(); ++level) {
+            const std::vector<Segment>& below = levels[level + 1];
+            std::size_t p = predict(levels[level], segment, key, below.size());
+            std::size_t lo = p > RECURSIVE_EPSILON + 1 ? p - RECURSIVE_EPSILON - 1 : 0;
+            std::size_t hi = std::min(below.size(), p + RECURSIVE_EPSILON + 3);
+            auto after = std::upper_bound(below.begin() + lo, below.begin() + hi, key,
+                                          [](const K& k, const Segment& s) { return k < s.key; });
+            segment = after == below.begin() ? 0 : static_cast<std::size_t>(after - below.begin()) - 1;
+        }
+        std::size_t p = predict(levels.back(), segment, key, n);
+        return {p > epsilon + 1 ? p - epsilon - 1 : 0, std::min(n, p + epsilon + 2)};
+    }
+
+    // Primeira posição i com !(sorted[i] < key), ou size()
+    std::size_t lower_bound(const K& key) const {
+        std::pair<std::size_t, std::size_t> window = search_window(key);
+        std::size_t lo = window.first, hi = window.second;
+        // Última milha: só a janela de ~2 epsilon em volta da previsão. As
+        // linhas dela são pedidas todas de uma vez, para as faltas de cache
+        // da busca binária chegarem juntas em vez de uma por passo
+        const char* line = reinterpret_cast<const char*>(data + lo);
+        const char* end = reinterpret_cast<const char*>(data + hi);
+        for (; line < end; line += CACHE_LINE) __builtin_prefetch(line);
+        std::size_t position = lo + branchless_lower_bound(data + lo, hi - lo, key);
+        if (position == lo && lo > 0 && !(data[lo - 1] < key)) {
+            return branchless_lower_bound(data, lo, key);
+        }
+        if (position == hi && hi < n) {
+            return gallop_right(hi, key);
+        }
+        return position;
+    }
+
+    bool contains(const K& key) const {
+        std::size_t position = lower_bound(key);
+        return position < n && !(key < data[position]);
+    }
+
+private:
+    const K* data = nullptr;
+    std::size_t n = 0;
+    std::size_t epsilon = DEFAULT_EPSILON;
+    std::vector<std::vector<Segment>> levels;  // levels.back() indexa as chaves
+
+    // key - origin sem estourar: inteiros subtraem em aritmética sem sinal
+    static double delta(const K& key, const K& origin) {
+        std::is_integral<K> integral;
+        return key < origin ? -magnitude(origin, key, integral) : magnitude(key, origin, integral);
+    }
+
+    static double magnitude(const K& high, const K& low, std::true_type) {
+        using U = typename std::make_unsigned<K>::type;
+        return static_cast<double>(static_cast<U>(static_cast<U>(high) - static_cast<U>(low)));
+    }
+
+    static double magnitude(const K& high, const K& low, std::false_type) {
+        return static_cast<double>(high - low);
+    }
+
+    // Posição prevista pelo segmento; depois da última chave dele a reta
+    // não tem garantia, então a previsão para no começo do seguinte
+    static std::size_t predict(const std::vector<Segment>& level, std::size_t segment, const K& key,
+                               std::size_t size) {
+        const Segment& s = level[segment];
+        double limit = segment + 1 < level.size() ? level[segment + 1].intercept : static_cast<double>(size);
+        double position = std::min(s.intercept + s.slope * delta(key, s.key), limit);
+        if (!(position > 0)) return 0;
+        return static_cast<std::size_t>(position);
+    }
+
+    // Cone de inclinações: fecha o segmento quando nenhuma reta serve a todos os pontos
+    static std::vector<Segment> build_segments(const K* keys, std::size_t count, std::size_t eps) {
+        std::vector<Segment> result;
+        const double e = static_cast<double>(eps);
+        K origin = keys[0];
+        double start = 0, slope_lo = 0, slope_hi = 0;
+        bool open = false;  // o segmento já tem um segundo ponto (e um cone finito)
+        auto close = [&] {
+            double slope = open ? (slope_lo + slope_hi) / 2 : 0;
+            result.push_back({origin, slope, start});
+        };
+        for (std::size_t i = 1; i < count; ++i) {
+            if (!(keys[i - 1] < keys[i])) continue;  // repetidas: vale a primeira posição
+            double dx = delta(keys[i], origin);
+            double dy = static_cast<double>(i) - start;
+            double lo = (dy - e) / dx, hi = (dy + e) / dx;
+            if (!open) {
+                slope_lo = std::max(0.0, lo);
+                slope_hi = hi;
+                open = true;
+            } else if (std::max(slope_lo, lo) <= std::min(slope_hi, hi)) {
+                slope_lo = std::max(slope_lo, lo);
+                slope_hi = std::min(slope_hi, hi);
+            } else {
+                close();
+                origin = keys[i];
+                start = static_cast<double>(i);
+                open = false;
+            }
+        }
+        close();
+        return result;
+    }
+
+    std::size_t gallop_right(std::size_t from, const K& key) const {
+        std::size_t lo = from, step = 1;
+        while (lo + step <= n && data[lo + step - 1] < key) {
+            lo += step;
+            step *= 2;
+        }
+        std::size_t hi = std::min(n, lo + step - 1);
+        return lo + branchless_lower_bound(data + lo, hi - lo, key);
+    }
+};
+
+#endif
@@ -0,0 +1,64 @@
+#ifndef MEMORIA_ALINHADA_H
+#define MEMORIA_ALINHADA_H
+
+#include <cstddef>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <sys/mman.h>
+
+/**
+ * Vetor de tamanho fixo alinhado a linhas de cache
+ *
+ * Objetivo:
+ *   Os índices de busca (Eytzinger, S-tree) organizam as chaves em
+ *   blocos de 64 bytes e dependem de cada bloco começar numa linha de
+ *   cache: assim um prefetch ou uma carga AVX2 toca uma linha só.
+ *   std::vector não garante esse alinhamento, então este contêiner
+ *   mínimo aloca com std::aligned_alloc. Só serve para tipos triviais
+ *   (as chaves), que não precisam de construtor nem destrutor.
+ *
+ *   Vetores a partir de 2 MB são alinhados a página grande e marcados
+ *   com MADV_HUGEPAGE: numa busca por centenas de MB cada passo cai numa
+ *   página diferente, e com páginas de 4 KB a falta na TLB custa quase
+ *   tanto quanto a falta de cache.
+ */
+
+const std::size_t CACHE_LINE = 64;
+const std::size_t HUGE_PAGE = std::size_t(2) << 20;
+
+template <typename T>
+class AlignedArray {
+    static_assert(std::is_trivially_copyable<T>::value, "AlignedArray: só tipos triviais");
+
+public:
+    AlignedArray() = default;
+
+    explicit AlignedArray(std::size_t count) : count(count) {
+        std::size_t alignment = count * sizeof(T) >= HUGE_PAGE ? HUGE_PAGE : CACHE_LINE;
+        std::size_t bytes = (count * sizeof(T) + alignment - 1) / alignment * alignment;
+        if (bytes == 0) return;
+        void* memory = std::aligned_alloc(alignment, bytes);
+        if (memory == nullptr) throw std::bad_alloc();
+        if (alignment == HUGE_PAGE) ::madvise(memory, bytes, MADV_HUGEPAGE);
+        data_.reset(static_cast<T*>(memory));
+    }
+
+    T* data() { return data_.get(); }
+    const T* data() const { return data_.get(); }
+    std::size_t size() const { return count; }
+    std::size_t bytes() const { return count * sizeof(T); }
+
+    T& operator[](std::size_t i) { return data_.get()[i]; }
+    const T& operator[](std::size_t i) const { return data_.get()[i]; }
+
+private:
+    struct Free {
+        void operator()(T* p) const { std::free(p); }
+    };
+    std::unique_ptr<T, Free> data_;
+    std::size_t count = 0;
+};
+
+#endif
@@ -0,0 +1,227 @@
+#ifndef S_TREE_H
+#define S_TREE_H
+
+#include "memoria_alinhada.h"
+#include "thread_pool.h"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+/**
+ * S-tree: B+ tree estática com nós de uma linha de cache
+ *
+ * Objetivo:
+ *   Índice somente leitura sobre chaves ordenadas de 32 bits (int32_t
+ *   ou uint32_t). A busca binária faz log2(n) faltas de cache
+ *   dependentes; aqui cada nó tem 16 chaves (64 bytes, uma linha) e 17
+ *   filhos, então a altura é log17(n): 8 níveis para 500 milhões de
+ *   chaves, em vez de 29 passos.
+ *     - As folhas são as próprias chaves, em ordem, preenchidas até um
+ *       múltiplo de 16 com o maior valor. A posição na folha é a posição
+ *       no vetor ordenado, o que torna a varredura de intervalo uma
+ *       leitura sequencial.
+ *     - Os níveis internos ficam em seguida, sem ponteiros: o filho i do
+ *       nó k é o nó 17k + i do nível de baixo, e a chave i do nó é a
+ *       menor chave do filho i + 1.
+ *     - Dentro do nó, a posição é o número de chaves menores que x: com
+ *       AVX2 são duas comparações de 8 lanes (cmpgt), um movemask e um
+ *       popcount, sem desvio nenhum. Sem AVX2 o mesmo cálculo é escalar.
+ *   uint32_t é guardado com o bit de sinal invertido, para a comparação
+ *   com sinal do AVX2 dar a ordem sem sinal.
+ *
+ *   A construção copia as folhas e calcula cada chave interna descendo
+ *   pelos filhos mais à esquerda; com o ThreadPool os blocos de cada
+ *   nível são divididos entre as threads (parallel_for).
+ *
+ * Complexidade:
+ *   - Construção: O(n) (as chaves internas são ~n/16)
+ *   - lower_bound/upper_bound: O(log17 n) nós, uma linha de cache cada
+ *   - Intervalo: O(log17 n + resultado)
+ *   - Espaço: ~17/16 n chaves
+ */
+
+namespace busca_detail {
+
+const std::size_t S_TREE_B = 16;
+
+// Chave de 32 bits como int32_t com a mesma ordem
+inline std::int32_t s_tree_encode(std::int32_t key) { return key; }
+inline std::int32_t s_tree_encode(std::uint32_t key) { return static_cast<std::int32_t>(key ^ 0x80000000u); }
+
+template <typename T>
+T s_tree_decode(std::int32_t key) {
+    return std::is_signed<T>::value ? static_cast<T>(key) : static_cast<T>(static_cast<std::uint32_t>(key) ^ 0x80000000u);
+}
+
+#ifdef __AVX2__
+// Quantas das 16 chaves do nó são < x
+inline unsigned count_less(const std::int32_t* node, __m256i x) {
+    __m256i a = _mm256_load_si256(reinterpret_cast<const __m256i*>(node));
+    __m256i b = _mm256_load_si256(reinterpret_cast<const __m256i*>(node + 8));
+    __m256i less = _mm256_packs_epi32(_mm256_cmpgt_epi32(x, a), _mm256_cmpgt_epi32(x, b));
+    return static_cast<unsigned>(__builtin_popcount(_mm256_movemask_epi8(less))) / 2;
+}
+
+// Quantas das 16 chaves do nó são <= x
+inline unsigned count_less_equal(const std::int32_t* node, __m256i x) {
+    __m256i a = _mm256_load_si256(reinterpret_cast<const __m256i*>(node));
+    __m256i b = _mm256_load_si256(reinterpret_cast<const __m256i*>(node + 8));
+    __m256i greater = _mm256_packs_epi32(_mm256_cmpgt_epi32(a, x), _mm256_cmpgt_epi32(b, x));
+    return S_TREE_B - static_cast<unsigned>(__builtin_popcount(_mm256_movemask_epi8(greater))) / 2;
+}
+#else
+inline unsigned count_less(const std::int32_t* node, std::int32_t x) {
+    unsigned count = 0;
+    for (std::size_t i = 0; i < S_TREE_B; ++i) count += node[i] < x;
+    return count;
+}
+
+inline unsigned count_less_equal(const std::int32_t* node, std::int32_t x) {
+    unsigned count = 0;
+    for (std::size_t i = 0; i < S_TREE_B; ++i) count += node[i] <= x;
+    return count;
+}
+#endif
+
+}
+
+template <typename T>
+class STree {
+    static_assert(std::is_same<T, std::int32_t>::value || std::is_same<T, std::uint32_t>::value,
+                  "STree: chaves int32_t ou uint32_t");
+
+public:
+    STree() = default;
+
+    // sorted deve estar em ordem crescente
+    explicit STree(const std::vector<T>& sorted) : STree(sorted.data(), sorted.size()) {}
+
+    STree(const T* sorted, std::size_t n) : n(n) {
+        allocate();
+        for (std::size_t layer = 0; layer < layer_offset.size(); ++layer) fill(layer, sorted, 0, layer_nodes(layer));
+    }
+
+    STree(ThreadPool& pool, const T* sorted, std::size_t n) : n(n) {
+        allocate();
+        for (std::size_t layer = 0; layer < layer_offset.size(); ++layer) {
+            parallel_for(pool, 0, layer_nodes(layer), BUILD_GRAIN,
+                         [&](std::size_t lo, std::size_t hi) { fill(layer, sorted, lo, hi); });
+        }
+    }
+
+    std::size_t size() const { return n; }
+    std::size_t height() const { return layer_offset.size(); }
+    std::size_t memory_bytes() const { return keys.bytes(); }
+
+    T key_at(std::size_t position) const { return busca_detail::s_tree_decode<T>(keys[position]); }
+
+    // Primeira posição com chave >= key, ou size()
+    std::size_t lower_bound(const T& key) const {
+        std::int32_t x = busca_detail::s_tree_encode(key);
+#ifdef __AVX2__
+        __m256i probe = _mm256_set1_epi32(x);
+#else
+        std::int32_t probe = x;
+#endif
+        std::size_t k = 0;
+        for (std::size_t layer = layer_offset.size() - 1; layer > 0; --layer) {
+            k = k * (B + 1) + busca_detail::count_less(node(layer, k), probe);
+        }
+        std::size_t position = k * B + busca_detail::count_less(node(0, k), probe);
+        return position < n ? position : n;
+    }
+
+    // Primeira posição com chave > key, ou size()
+    std::size_t upper_bound(const T& key) const {
+        // Os separadores de filhos inexistentes valem o máximo: só ele os alcançaria
+        if (key == std::numeric_limits<T>::max()) return n;
+        std::int32_t x = busca_detail::s_tree_encode(key);
+#ifdef __AVX2__
+        __m256i probe = _mm256_set1_epi32(x);
+#else
+        std::int32_t probe = x;
+#endif
+        std::size_t k = 0;
+        for (std::size_t layer = layer_offset.size() - 1; layer > 0; --layer) {
+            k = k * (B + 1) + busca_detail::count_less_equal(node(layer, k), probe);
+        }
+        std::size_t position = k * B + busca_detail::count_less_equal(node(0, k), probe);
+        return position < n ? position : n;
+    }
+
+    // Posições [primeira, fim) das chaves em [lo, hi]
+    std::pair<std::size_t, std::size_t> range(const T& lo, const T& hi) const {
+        if (hi < lo) return {n, n};
+        return {lower_bound(lo), upper_bound(hi)};
+    }
+
+    // Chama fn(chave) para cada chave em [lo, hi], em ordem; devolve quantas
+    template <typename Fn>
+    std::size_t range_scan(const T& lo, const T& hi, Fn fn) const {
+        std::pair<std::size_t, std::size_t> bounds = range(lo, hi);
+        for (std::size_t i = bounds.first; i < bounds.second; ++i) fn(key_at(i));
+        return bounds.second - bounds.first;
+    }
+
+private:
+    static const std::size_t B = busca_detail::S_TREE_B;
+    // Nós por tarefa na construção paralela
+    static const std::size_t BUILD_GRAIN = std::size_t(1) << 14;
+
+    std::size_t n = 0;
+    std::vector<std::size_t> layer_offset;  // em chaves; nível 0 = folhas
+    AlignedArray<std::int32_t> keys;
+
+    const std::int32_t* node(std::size_t layer, std::size_t k) const {
+        return keys.data() + layer_offset[layer] + k * B;
+    }
+
+    std::size_t layer_nodes(std::size_t layer) const {
+        std::size_t end = layer + 1 < layer_offset.size() ? layer_offset[layer + 1] : keys.size();
+        return (end - layer_offset[layer]) / B;
+    }
+
+    void allocate() {
+        // Cada nível tem ceil(nós de baixo / 17) nós; para no que tem um só
+        std::size_t nodes = std::max<std::size_t>(1, (n + B - 1) / B);
+        std::size_t total = 0;
+        while (true) {
+            layer_offset.push_back(total);
+            total += nodes * B;
+            if (nodes == 1) break;
+            nodes = (nodes + B) / (B + 1);
+        }
+        keys = AlignedArray<std::int32_t>(total);
+    }
+
+    // Preenche os nós [first, last) do nível layer
+    void fill(std::size_t layer, const T* sorted, std::size_t first, std::size_t last) {
+        const std::int32_t INF = std::numeric_limits<std::int32_t>::max();
+        std::int32_t* out = keys.data() + layer_offset[layer];
+        if (layer == 0) {
+            for (std::size_t i = first * B; i < last * B; ++i) {
+                out[i] = i < n ? busca_detail::s_tree_encode(sorted[i]) : INF;
+            }
+            return;
+        }
+        for (std::size_t k = first; k < last; ++k) {
+            for (std::size_t i = 0; i < B; ++i) {
+                // Menor chave do filho i + 1: desce sempre pelo primeiro filho até a folha
+                std::size_t child = k * (B + 1) + i + 1;
+                for (std::size_t down = 1; down < layer; ++down) child *= B + 1;
+                std::size_t leaf = child * B;
+                out[k * B + i] = leaf < n ? busca_detail::s_tree_encode(sorted[leaf]) : INF;
+            }
+        }
+    }
+};
+
+#endif
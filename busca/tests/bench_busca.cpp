@@ -0,0 +1,161 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include "busca_binaria.h"
+#include "busca_em_lote.h"
+#include "eytzinger.h"
+#include "s_tree.h"
+
+using namespace std;
+
+// binarySearch de binary-search.cpp, com índices size_t e devolvendo o ponto de inserção
+size_t textbook_lower_bound(const vector<uint32_t>& arr, uint32_t target) {
+    size_t left = 0, right = arr.size();
+    while (left < right) {
+        size_t mid = left + (right - left) / 2;
+        if (arr[mid] < target) {
+            left = mid + 1;
+        } else {
+            right = mid;
+        }
+    }
+    return left;
+}
+
+template <typename Fn>
+double seconds(Fn fn) {
+    auto start = chrono::steady_clock::now();
+    fn();
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+// Nanossegundos por busca; cada consulta depende da anterior (mede latência,
+// não vazão) e o checksum impede que o compilador descarte o laço
+template <typename Search>
+double latency_ns(const vector<uint32_t>& queries, Search search, uint64_t& checksum) {
+    auto start = chrono::steady_clock::now();
+    uint64_t sum = 0;
+    size_t last = 0;
+    for (uint32_t key : queries) {
+        last = search(key ^ static_cast<uint32_t>(last & 1));
+        sum += last;
+    }
+    auto end = chrono::steady_clock::now();
+    checksum += sum;
+    return chrono::duration<double, nano>(end - start).count() / queries.size();
+}
+
+// Milhões de buscas por segundo para um lote inteiro de consultas independentes
+template <typename Batch>
+double mlookups(const vector<uint32_t>& queries, Batch batch, uint64_t& checksum) {
+    vector<size_t> positions(queries.size());
+    auto start = chrono::steady_clock::now();
+    batch(queries, positions);
+    auto end = chrono::steady_clock::now();
+    for (size_t p : positions) checksum += p;
+    return queries.size() / chrono::duration<double>(end - start).count() / 1e6;
+}
+
+void bench_batches(size_t n_max, size_t queries_count, mt19937_64& rng, uint64_t& checksum) {
+    cout << "\nBUSCA EM LOTE (uint32, " << queries_count << " consultas, milhões de buscas/s)" << endl;
+    cout << setw(12) << "n" << setw(11) << "por chave" << setw(11) << "lote" << setw(13) << "eytz chave"
+         << setw(12) << "eytz lote" << setw(12) << "ordenadas" << setw(10) << "ganho" << endl;
+    for (size_t n = 1000; n <= n_max; n *= 10) {
+        vector<uint32_t> sorted(n);
+        for (auto& key : sorted) key = static_cast<uint32_t>(rng());
+        sort(sorted.begin(), sorted.end());
+        EytzingerIndex<uint32_t> index(sorted);
+        vector<uint32_t> queries(queries_count);
+        for (auto& key : queries) key = static_cast<uint32_t>(rng());
+        vector<uint32_t> sorted_queries = queries;
+        sort(sorted_queries.begin(), sorted_queries.end());
+
+        // O laço de hoje: binarySearch uma chave por vez
+        double per_key = mlookups(queries, [&](const vector<uint32_t>& q, vector<size_t>& out) {
+            for (size_t i = 0; i < q.size(); ++i) out[i] = textbook_lower_bound(sorted, q[i]);
+        }, checksum);
+        double batch = mlookups(queries, [&](const vector<uint32_t>& q, vector<size_t>& out) {
+            batch_lower_bound(sorted.data(), n, q.data(), q.size(), out.data());
+        }, checksum);
+        double eyt_key = mlookups(queries, [&](const vector<uint32_t>& q, vector<size_t>& out) {
+            for (size_t i = 0; i < q.size(); ++i) out[i] = index.lower_bound(q[i]);
+        }, checksum);
+        double eyt_batch = mlookups(queries, [&](const vector<uint32_t>& q, vector<size_t>& out) {
+            index.lower_bound_batch(q.data(), q.size(), out.data());
+        }, checksum);
+        double in_order = mlookups(sorted_queries, [&](const vector<uint32_t>& q, vector<size_t>& out) {
+            sorted_batch_lower_bound(sorted.data(), n, q.data(), q.size(), out.data());
+        }, checksum);
+
+        cout << setw(12) << n << fixed << setprecision(1) << setw(11) << per_key << setw(11) << batch
+             << setw(13) << eyt_key << setw(12) << eyt_batch << setw(12) << in_order
+             << setw(9) << max(batch, eyt_batch) / per_key << "x" << endl;
+    }
+}
+
+// Tempo de reconstrução dos índices a partir do vetor ordenado
+void bench_builds(size_t n_max, mt19937_64& rng) {
+    cout << "\nCONSTRUÇÃO (segundos, uint32, " << thread::hardware_concurrency() << " threads)" << endl;
+    cout << setw(12) << "n" << setw(12) << "eytzinger" << setw(10) << "s-tree" << setw(12) << "s-tree par"
+         << setw(14) << "s-tree MB" << endl;
+    ThreadPool pool;
+    for (size_t n = 1000000; n <= n_max; n *= 10) {
+        vector<uint32_t> sorted(n);
+        uint32_t key = 0;
+        for (auto& k : sorted) k = key += static_cast<uint32_t>(rng() % 8);
+        double t_eyt = seconds([&] { EytzingerIndex<uint32_t> index(sorted); });
+        double t_st = seconds([&] { STree<uint32_t> tree(sorted); });
+        size_t bytes = 0;
+        double t_par = seconds([&] {
+            STree<uint32_t> tree(pool, sorted.data(), n);
+            bytes = tree.memory_bytes();
+        });
+        cout << setw(12) << n << fixed << setprecision(3) << setw(12) << t_eyt << setw(10) << t_st
+             << setw(12) << t_par << setw(14) << setprecision(1) << bytes / 1048576.0 << endl;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    size_t n_max = argc > 1 ? strtoull(argv[1], nullptr, 10) : 100000000;
+    const size_t QUERIES = 2000000;
+
+    mt19937_64 rng(42);
+    cout << "BUSCA EM VETOR ORDENADO (uint32, ns por busca, consultas dependentes)" << endl;
+    cout << setw(12) << "n" << setw(12) << "textbook" << setw(14) << "std::lower" << setw(13) << "branchless"
+         << setw(12) << "eytzinger" << setw(10) << "s-tree" << setw(10) << "ganho" << endl;
+
+    uint64_t checksum = 0;
+    for (size_t n = 1000; n <= n_max; n *= 10) {
+        vector<uint32_t> sorted(n);
+        for (auto& key : sorted) key = static_cast<uint32_t>(rng());
+        sort(sorted.begin(), sorted.end());
+        EytzingerIndex<uint32_t> index(sorted);
+        STree<uint32_t> s_tree(sorted);
+
+        vector<uint32_t> queries(QUERIES);
+        for (auto& key : queries) key = static_cast<uint32_t>(rng());
+
+        double t_text = latency_ns(queries, [&](uint32_t k) { return textbook_lower_bound(sorted, k); }, checksum);
+        double t_std = latency_ns(queries, [&](uint32_t k) {
+            return static_cast<size_t>(lower_bound(sorted.begin(), sorted.end(), k) - sorted.begin());
+        }, checksum);
+        double t_bl = latency_ns(queries, [&](uint32_t k) { return branchless_lower_bound(sorted, k); }, checksum);
+        double t_eyt = latency_ns(queries, [&](uint32_t k) { return index.lower_bound(k); }, checksum);
+        double t_st = latency_ns(queries, [&](uint32_t k) { return s_tree.lower_bound(k); }, checksum);
+
+        cout << setw(12) << n << fixed << setprecision(1) << setw(12) << t_text << setw(14) << t_std
+             << setw(13) << t_bl << setw(12) << t_eyt << setw(10) << t_st << setw(9) << t_text / min(t_eyt, t_st)
+             << "x" << endl;
+    }
+    bench_batches(n_max, QUERIES, rng, checksum);
+    bench_builds(n_max, rng);
+    cout << "(checksum " << checksum << ")" << endl;
+    return 0;
+}
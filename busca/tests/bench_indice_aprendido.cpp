@@ -0,0 +1,108 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include "busca_binaria.h"
+#include "indice_aprendido.h"
+
+using namespace std;
+
+// binarySearch de binary-search.cpp, com índices size_t e devolvendo o ponto de inserção
+size_t textbook_lower_bound(const vector<uint64_t>& arr, uint64_t target) {
+    size_t left = 0, right = arr.size();
+    while (left < right) {
+        size_t mid = left + (right - left) / 2;
+        if (arr[mid] < target) {
+            left = mid + 1;
+        } else {
+            right = mid;
+        }
+    }
+    return left;
+}
+
+template <typename Fn>
+double seconds(Fn fn) {
+    auto start = chrono::steady_clock::now();
+    fn();
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+// ns por busca, com cada consulta dependendo da anterior
+template <typename Search>
+double latency_ns(const vector<uint64_t>& queries, Search search, uint64_t& checksum) {
+    uint64_t sum = 0;
+    size_t last = 0;
+    double t = seconds([&] {
+        for (uint64_t key : queries) {
+            last = search(key ^ (last & 1));
+            sum += last;
+        }
+    });
+    checksum += sum;
+    return t * 1e9 / queries.size();
+}
+
+void bench_distribution(const string& name, vector<uint64_t> keys, mt19937_64& rng, uint64_t& checksum) {
+    sort(keys.begin(), keys.end());
+    const size_t QUERIES = 1000000;
+    vector<uint64_t> queries(QUERIES);
+    // Metade chaves presentes, metade valores entre a menor e a maior
+    for (size_t i = 0; i < QUERIES; ++i) {
+        queries[i] = i % 2 ? keys[rng() % keys.size()] : keys.front() + rng() % (keys.back() - keys.front() + 1);
+    }
+
+    cout << "\n" << name << " (n = " << keys.size() << ")" << endl;
+    double t_text = latency_ns(queries, [&](uint64_t k) { return textbook_lower_bound(keys, k); }, checksum);
+    double t_bl = latency_ns(queries, [&](uint64_t k) { return branchless_lower_bound(keys, k); }, checksum);
+    cout << "  " << left << setw(16) << "binarySearch" << right << fixed << setprecision(1) << setw(8) << t_text
+         << " ns" << endl;
+    cout << "  " << left << setw(16) << "branchless" << right << setw(8) << t_bl << " ns" << endl;
+    for (size_t eps : {16, 64, 256}) {
+        PgmIndex<uint64_t> index;
+        double build = seconds([&] { index = PgmIndex<uint64_t>(keys, eps); });
+        double t = latency_ns(queries, [&](uint64_t k) { return index.lower_bound(k); }, checksum);
+        cout << "  " << left << setw(16) << ("PGM eps=" + to_string(eps)) << right << setw(8) << t << " ns"
+             << setw(10) << index.segments() << " segmentos" << setw(12) << index.memory_bytes() << " bytes"
+             << setw(4) << index.height() << " níveis" << setprecision(3) << setw(8) << build << " s"
+             << setprecision(1) << endl;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    size_t n = argc > 1 ? strtoull(argv[1], nullptr, 10) : 10000000;
+    mt19937_64 rng(7);
+    uint64_t checksum = 0;
+    cout << "ÍNDICE APRENDIDO x BUSCA BINÁRIA (uint64, ns por busca, consultas dependentes)" << endl;
+
+    // Timestamps em ns de eventos com chegada de Poisson e rajadas
+    vector<uint64_t> keys(n);
+    uint64_t t = 1700000000000000000ull;
+    exponential_distribution<double> gap(1.0 / 5000);
+    for (size_t i = 0; i < n; ++i) keys[i] = t += 1 + static_cast<uint64_t>(gap(rng)) / (i % 100000 < 5000 ? 50 : 1);
+    bench_distribution("timestamps (Poisson com rajadas)", keys, rng, checksum);
+
+    // IDs sequenciais com faixas apagadas
+    uint64_t id = 1;
+    for (size_t i = 0; i < n; ++i) {
+        if (rng() % 10000 == 0) id += rng() % 1000000;
+        keys[i] = id++;
+    }
+    bench_distribution("IDs sequenciais com buracos", keys, rng, checksum);
+
+    uniform_int_distribution<uint64_t> uniform(0, UINT64_MAX >> 1);
+    for (auto& key : keys) key = uniform(rng);
+    bench_distribution("uniforme 63 bits", keys, rng, checksum);
+
+    lognormal_distribution<double> lognormal(0, 2);
+    for (auto& key : keys) key = static_cast<uint64_t>(lognormal(rng) * 1e12);
+    bench_distribution("lognormal (assimétrica)", keys, rng, checksum);
+
+    cout << "(checksum " << checksum << ")" << endl;
+    return 0;
+}
@@ -0,0 +1,90 @@
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include "busca_binaria.h"
+#include "eytzinger.h"
+#include "teste.h"
+
+// Compara as duas buscas com std::lower_bound em chaves presentes, ausentes e nos extremos
+template <typename T>
+bool matches_std(const std::vector<T>& sorted, const std::vector<T>& queries) {
+    EytzingerIndex<T> index(sorted);
+    for (const T& key : queries) {
+        std::size_t expected = static_cast<std::size_t>(std::lower_bound(sorted.begin(), sorted.end(), key) - sorted.begin());
+        if (branchless_lower_bound(sorted, key) != expected) return false;
+        if (index.lower_bound(key) != expected) return false;
+        bool present = expected < sorted.size() && !(key < sorted[expected]);
+        if (index.contains(key) != present) return false;
+    }
+    return true;
+}
+
+int main() {
+    std::cout << "TESTES DA BUSCA BINÁRIA" << std::endl;
+    std::cout << std::string(60, '=') << std::endl;
+
+    // Exemplo de binary-search.cpp
+    std::vector<int> arr = {2, 3, 4, 10, 40, 55, 78, 99};
+    check(branchless_lower_bound(arr, 10) == 3, "branchless: 10 está no índice 3");
+    check(branchless_lower_bound(arr, 5) == 3 && branchless_lower_bound(arr, 100) == arr.size(),
+          "branchless: ausentes devolvem o ponto de inserção");
+    EytzingerIndex<int> small(arr);
+    check(small.lower_bound(10) == 3 && small.contains(99) && !small.contains(5) && small.lower_bound(1) == 0,
+          "Eytzinger: mesmas posições do vetor ordenado");
+
+    // rank_of percorre o vetor ordenado: a travessia simétrica da árvore
+    bool ranks_ok = true;
+    for (std::size_t n = 1; n <= 600 && ranks_ok; ++n) {
+        std::vector<int> sorted(n);
+        for (std::size_t i = 0; i < n; ++i) sorted[i] = static_cast<int>(i);
+        EytzingerIndex<int> index(sorted);
+        std::vector<bool> seen(n, false);
+        for (std::size_t k = 1; k <= n; ++k) {
+            std::size_t r = index.rank_of(k);
+            if (r >= n || seen[r]) ranks_ok = false;
+            else seen[r] = true;
+            // Filho esquerdo vem antes e direito depois
+            if (2 * k <= n && index.rank_of(2 * k) >= r) ranks_ok = false;
+            if (2 * k + 1 <= n && index.rank_of(2 * k + 1) <= r) ranks_ok = false;
+        }
+    }
+    check(ranks_ok, "rank_of é a ordem simétrica para n de 1 a 600");
+
+    std::mt19937_64 rng(2024);
+    bool ok = true;
+    for (std::size_t n : {0, 1, 2, 3, 15, 16, 17, 31, 32, 33, 1000, 65535, 65536, 100000}) {
+        for (std::uint32_t range : {10u, 1u << 20, UINT32_MAX}) {
+            std::vector<std::uint32_t> sorted(n);
+            for (auto& key : sorted) key = static_cast<std::uint32_t>(rng() % range);
+            std::sort(sorted.begin(), sorted.end());
+            std::vector<std::uint32_t> queries = {0, UINT32_MAX, range - 1, range};
+            for (int q = 0; q < 2000; ++q) queries.push_back(static_cast<std::uint32_t>(rng() % range));
+            for (std::size_t i = 0; i < n; i += 1 + n / 500) queries.push_back(sorted[i]);
+            ok = ok && matches_std(sorted, queries);
+        }
+    }
+    check(ok, "uint32: igual a std::lower_bound (repetidos, ausentes, extremos)");
+
+    std::vector<double> reals(5000);
+    for (auto& x : reals) x = std::uniform_real_distribution<double>(-1e6, 1e6)(rng);
+    std::sort(reals.begin(), reals.end());
+    std::vector<double> real_queries(reals.begin(), reals.begin() + 100);
+    for (int q = 0; q < 1000; ++q) real_queries.push_back(std::uniform_real_distribution<double>(-2e6, 2e6)(rng));
+    check(matches_std(reals, real_queries), "double: igual a std::lower_bound");
+
+    std::vector<std::uint64_t> wide(3000);
+    for (std::size_t i = 0; i < wide.size(); ++i) wide[i] = (std::uint64_t(i) << 33) | 7;
+    std::vector<std::uint64_t> wide_queries;
+    for (std::size_t i = 0; i < wide.size(); i += 7) wide_queries.push_back(wide[i] - 1);
+    check(matches_std(wide, wide_queries), "uint64: chaves acima de 2^32");
+
+    EytzingerIndex<std::uint32_t> constant(std::vector<std::uint32_t>(1000, 5));
+    check(constant.lower_bound(5) == 0 && constant.lower_bound(6) == 1000 && constant.memory_bytes() == 1001 * sizeof(std::uint32_t),
+          "todas as chaves iguais; memória de n + 1 chaves");
+
+    std::cout << std::string(60, '=') << std::endl;
+    return test_summary();
+}
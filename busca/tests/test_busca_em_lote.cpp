@@ -0,0 +1,77 @@
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "busca_em_lote.h"
+#include "eytzinger.h"
+#include "teste.h"
+
+std::vector<std::size_t> expected_positions(const std::vector<std::uint32_t>& sorted,
+                                            const std::vector<std::uint32_t>& queries) {
+    std::vector<std::size_t> positions;
+    for (std::uint32_t key : queries) {
+        positions.push_back(static_cast<std::size_t>(std::lower_bound(sorted.begin(), sorted.end(), key) - sorted.begin()));
+    }
+    return positions;
+}
+
+int main() {
+    std::cout << "TESTES DA BUSCA EM LOTE" << std::endl;
+    std::cout << std::string(60, '=') << std::endl;
+
+    std::vector<int> arr = {2, 3, 4, 10, 40, 55, 78, 99};
+    std::vector<int> keys = {10, 1, 100, 55, 5};
+    check(batch_lower_bound(arr, keys) == std::vector<std::size_t>({3, 0, 8, 5, 3}),
+          "lote no exemplo de binary-search.cpp");
+
+    std::mt19937_64 rng(17);
+    bool batch_ok = true, eytzinger_ok = true, sorted_ok = true;
+    // Tamanhos de lote que não são múltiplos do grupo
+    for (std::size_t n : {0, 1, 2, 7, 16, 100, 4096, 100000}) {
+        for (std::size_t count : {0, 1, 15, 16, 17, 1000}) {
+            std::vector<std::uint32_t> sorted(n);
+            for (auto& key : sorted) key = static_cast<std::uint32_t>(rng() % (4 * n + 1));
+            std::sort(sorted.begin(), sorted.end());
+            std::vector<std::uint32_t> queries(count);
+            for (auto& key : queries) key = static_cast<std::uint32_t>(rng() % (4 * n + 3));
+            if (count > 0) queries[0] = UINT32_MAX;
+
+            std::vector<std::size_t> expected = expected_positions(sorted, queries);
+            batch_ok = batch_ok && batch_lower_bound(sorted, queries) == expected;
+            eytzinger_ok = eytzinger_ok && EytzingerIndex<std::uint32_t>(sorted).lower_bound_batch(queries) == expected;
+
+            std::sort(queries.begin(), queries.end());
+            sorted_ok = sorted_ok && sorted_batch_lower_bound(sorted, queries) == expected_positions(sorted, queries);
+        }
+    }
+    check(batch_ok, "batch_lower_bound igual a std::lower_bound");
+    check(eytzinger_ok, "EytzingerIndex::lower_bound_batch igual a std::lower_bound");
+    check(sorted_ok, "sorted_batch_lower_bound igual a std::lower_bound");
+
+    // Consultas ordenadas densas e esparsas, com repetidas
+    std::vector<std::uint32_t> sorted(1000000);
+    for (std::size_t i = 0; i < sorted.size(); ++i) sorted[i] = static_cast<std::uint32_t>(3 * i);
+    std::vector<std::uint32_t> dense, sparse;
+    for (std::uint32_t key = 0; key < 3000; ++key) dense.push_back(key);
+    for (std::uint32_t key = 0; key < 3000000; key += 99991) {
+        sparse.push_back(key);
+        sparse.push_back(key);
+    }
+    check(sorted_batch_lower_bound(sorted, dense) == expected_positions(sorted, dense) &&
+              sorted_batch_lower_bound(sorted, sparse) == expected_positions(sorted, sparse),
+          "ordenado: consultas densas, esparsas e repetidas");
+
+    bool threw = false;
+    try {
+        sorted_batch_lower_bound(sorted, std::vector<std::uint32_t>{5, 4});
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    check(threw, "ordenado: consultas fora de ordem lançam invalid_argument");
+
+    std::cout << std::string(60, '=') << std::endl;
+    return test_summary();
+}
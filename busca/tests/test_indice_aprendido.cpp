@@ -0,0 +1,101 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "indice_aprendido.h"
+#include "teste.h"
+
+// lower_bound igual ao de std e, para chaves presentes, resposta dentro da janela
+template <typename K>
+bool matches_std(const std::vector<K>& sorted, const std::vector<K>& queries, std::size_t epsilon,
+                 bool distinct = true) {
+    PgmIndex<K> index(sorted, epsilon);
+    for (const K& key : queries) {
+        std::size_t expected = static_cast<std::size_t>(std::lower_bound(sorted.begin(), sorted.end(), key) - sorted.begin());
+        if (index.lower_bound(key) != expected) return false;
+        if (distinct) {
+            auto window = index.search_window(key);
+            if (expected < window.first || expected > window.second) return false;
+        }
+    }
+    return true;
+}
+
+template <typename K>
+std::vector<K> with_queries(const std::vector<K>& sorted, std::mt19937_64& rng, std::vector<K> extra) {
+    for (std::size_t i = 0; i < sorted.size(); i += 1 + sorted.size() / 2000) {
+        extra.push_back(sorted[i]);
+        extra.push_back(sorted[i] + 1);
+    }
+    for (int q = 0; q < 500 && !sorted.empty(); ++q) extra.push_back(sorted[rng() % sorted.size()] - 1);
+    return extra;
+}
+
+int main() {
+    std::cout << "TESTES DO ÍNDICE APRENDIDO" << std::endl;
+    std::cout << std::string(60, '=') << std::endl;
+
+    std::vector<int> arr = {2, 3, 4, 10, 40, 55, 78, 99};
+    PgmIndex<int> small(arr, 1);
+    check(small.lower_bound(10) == 3 && small.lower_bound(5) == 3 && small.lower_bound(100) == 8 &&
+              small.lower_bound(-5) == 0 && small.contains(78) && !small.contains(77),
+          "exemplo de binary-search.cpp com epsilon = 1");
+
+    std::mt19937_64 rng(5);
+    std::size_t n = 1000000;
+
+    // Timestamps em ns: uniformes com ruído
+    std::vector<std::uint64_t> timestamps(n);
+    std::uint64_t t = 1700000000000000000ull;
+    for (auto& key : timestamps) key = t += 1 + rng() % 2000;
+    bool ok = true;
+    for (std::size_t eps : {1, 8, 64, 512}) {
+        ok = ok && matches_std(timestamps, with_queries(timestamps, rng, {0, UINT64_MAX}), eps);
+    }
+    check(ok, "timestamps uint64: igual a std::lower_bound, resposta na janela (epsilon 1 a 512)");
+
+    PgmIndex<std::uint64_t> uniform(timestamps, 64);
+    check(uniform.segments() < 100 && uniform.memory_bytes() < 8192,
+          "10^6 timestamps uniformes: " + std::to_string(uniform.segments()) + " segmentos, " +
+              std::to_string(uniform.memory_bytes()) + " bytes");
+
+    // Lognormal (assimétrica), int64 com negativos
+    std::vector<std::int64_t> skewed(n);
+    std::lognormal_distribution<double> lognormal(0, 2);
+    for (auto& key : skewed) key = static_cast<std::int64_t>(lognormal(rng) * 1e9) - 1000000000;
+    std::sort(skewed.begin(), skewed.end());
+    skewed.erase(std::unique(skewed.begin(), skewed.end()), skewed.end());
+    check(matches_std(skewed, with_queries(skewed, rng, {INT64_MIN, INT64_MAX}), 32),
+          "lognormal int64: igual a std::lower_bound, resposta na janela");
+
+    std::vector<double> reals(200000);
+    for (auto& key : reals) key = std::normal_distribution<double>(0, 1e3)(rng);
+    std::sort(reals.begin(), reals.end());
+    check(matches_std(reals, with_queries(reals, rng, {-1e9, 1e9}), 16), "double normal: igual a std::lower_bound");
+
+    // Muitas repetições: janela não garantida, mas a resposta continua certa
+    std::vector<std::uint32_t> repeated(n);
+    for (auto& key : repeated) key = static_cast<std::uint32_t>(rng() % 1000) * (rng() % 50 == 0 ? 1000 : 1);
+    std::sort(repeated.begin(), repeated.end());
+    check(matches_std(repeated, with_queries(repeated, rng, {0u, UINT32_MAX}), 8, false),
+          "uint32 com longas repetições: igual a std::lower_bound");
+
+    std::vector<std::uint32_t> empty;
+    check(PgmIndex<std::uint32_t>(empty).lower_bound(7) == 0 && PgmIndex<std::uint32_t>(empty).segments() == 0,
+          "vetor vazio");
+
+    bool threw = false;
+    try {
+        PgmIndex<std::uint64_t> invalid(timestamps, 0);
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    check(threw, "epsilon = 0 lança invalid_argument");
+
+    std::cout << std::string(60, '=') << std::endl;
+    return test_summary();
+}
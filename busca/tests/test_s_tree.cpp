@@ -0,0 +1,90 @@
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+#include "s_tree.h"
+#include "teste.h"
+
+// lower_bound e upper_bound iguais aos de std para chaves presentes, ausentes e extremas
+template <typename T>
+bool matches_std(const STree<T>& tree, const std::vector<T>& sorted, const std::vector<T>& queries) {
+    for (const T& key : queries) {
+        std::size_t lower = static_cast<std::size_t>(std::lower_bound(sorted.begin(), sorted.end(), key) - sorted.begin());
+        std::size_t upper = static_cast<std::size_t>(std::upper_bound(sorted.begin(), sorted.end(), key) - sorted.begin());
+        if (tree.lower_bound(key) != lower || tree.upper_bound(key) != upper) return false;
+    }
+    return true;
+}
+
+template <typename T>
+bool random_trees(std::mt19937_64& rng, std::uint64_t range) {
+    for (std::size_t n : {0, 1, 15, 16, 17, 271, 272, 273, 4624, 4625, 100000}) {
+        std::vector<T> sorted(n);
+        for (auto& key : sorted) {
+            key = static_cast<T>(static_cast<std::int64_t>(rng() % range) + std::numeric_limits<T>::min());
+        }
+        std::sort(sorted.begin(), sorted.end());
+        STree<T> tree(sorted);
+
+        std::vector<T> queries = {std::numeric_limits<T>::min(), std::numeric_limits<T>::max()};
+        for (int q = 0; q < 3000; ++q) {
+            queries.push_back(static_cast<T>(static_cast<std::int64_t>(rng() % range) + std::numeric_limits<T>::min()));
+        }
+        for (std::size_t i = 0; i < n; i += 1 + n / 300) queries.push_back(sorted[i]);
+        if (!matches_std(tree, sorted, queries)) return false;
+    }
+    return true;
+}
+
+int main() {
+    std::cout << "TESTES DA S-TREE" << std::endl;
+    std::cout << std::string(60, '=') << std::endl;
+
+    std::vector<std::int32_t> arr = {2, 3, 4, 10, 40, 55, 78, 99};
+    STree<std::int32_t> small(arr);
+    check(small.lower_bound(10) == 3 && small.upper_bound(10) == 4 && small.lower_bound(5) == 3 &&
+              small.lower_bound(100) == 8 && small.height() == 1,
+          "exemplo de binary-search.cpp em uma folha");
+
+    std::mt19937_64 rng(99);
+    check(random_trees<std::int32_t>(rng, 1000) && random_trees<std::int32_t>(rng, std::uint64_t(1) << 32),
+          "int32: lower/upper_bound iguais a std (repetidos, negativos, extremos)");
+    check(random_trees<std::uint32_t>(rng, 50) && random_trees<std::uint32_t>(rng, std::uint64_t(1) << 32),
+          "uint32: ordem sem sinal, inclusive acima de 2^31");
+
+    // Máximo do tipo presente nas chaves
+    std::vector<std::uint32_t> with_max(5000);
+    for (std::size_t i = 0; i < with_max.size(); ++i) with_max[i] = static_cast<std::uint32_t>(i * 1000);
+    for (std::size_t i = 4990; i < with_max.size(); ++i) with_max[i] = UINT32_MAX;
+    STree<std::uint32_t> max_tree(with_max);
+    check(max_tree.lower_bound(UINT32_MAX) == 4990 && max_tree.upper_bound(UINT32_MAX) == 5000,
+          "chaves iguais ao máximo do tipo");
+
+    std::vector<std::int32_t> keys(1000000);
+    for (std::size_t i = 0; i < keys.size(); ++i) keys[i] = static_cast<std::int32_t>(2 * i) - 1000000;
+    STree<std::int32_t> tree(keys);
+    std::vector<std::int32_t> scanned;
+    std::size_t count = tree.range_scan(-11, 10, [&](std::int32_t key) { scanned.push_back(key); });
+    std::vector<std::int32_t> expected;
+    for (std::int32_t key = -10; key <= 10; key += 2) expected.push_back(key);
+    check(count == 11 && scanned == expected, "range_scan [-11, 10] devolve as 11 chaves em ordem");
+    check(tree.range(5, 4) == std::make_pair(tree.size(), tree.size()) &&
+              tree.range(-2000000, 2000000) == std::make_pair(std::size_t(0), tree.size()),
+          "intervalo vazio e intervalo com tudo");
+    check(tree.height() == 5 && tree.memory_bytes() < keys.size() * sizeof(std::int32_t) * 17 / 16 + 4096,
+          "10^6 chaves: altura 5, memória ~17/16 das chaves");
+
+    ThreadPool pool(4);
+    STree<std::int32_t> parallel(pool, keys.data(), keys.size());
+    bool same = parallel.height() == tree.height();
+    for (std::int32_t key = -1000005; key < 1000005 && same; key += 777) {
+        same = parallel.lower_bound(key) == tree.lower_bound(key);
+    }
+    check(same, "construção paralela igual à sequencial");
+
+    std::cout << std::string(60, '=') << std::endl;
+    return test_summary();
+}
@@ -0,0 +1,66 @@
+#ifndef SPSC_QUEUE_H
+#define SPSC_QUEUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+/**
+ * Fila circular sem travas para um produtor e um consumidor
+ *
+ * Objetivo:
+ *   Passar objetos entre duas threads que não podem esperar uma pela
+ *   outra (ilhas do algoritmo genético trocando migrantes). Só o
+ *   produtor escreve tail e só o consumidor escreve head; cada lado lê
+ *   o índice do outro com acquire e publica o seu com release, então
+ *   não há trava nem operação atômica de leitura-modificação-escrita.
+ *   Os dois índices ficam em linhas de cache separadas para o produtor
+ *   e o consumidor não disputarem a mesma linha.
+ *
+ *   try_push e try_pop nunca bloqueiam: com a fila cheia o push falha e
+ *   o produtor decide o que fazer (descartar, tentar depois).
+ *
+ *   try_pop troca o elemento com out em vez de movê-lo: a posição fica
+ *   com a memória antiga de out, e objetos com buffers (vetores) de
+ *   tamanho fixo circulam pela fila sem novas alocações.
+ *
+ * Complexidade:
+ *   - O(1) por operação, capacity + 1 posições
+ */
+
+template <typename T>
+class SpscQueue {
+public:
+    explicit SpscQueue(std::size_t capacity) : slots(capacity + 1) {}
+
+    SpscQueue(const SpscQueue&) = delete;
+    SpscQueue& operator=(const SpscQueue&) = delete;
+
+    // Só o produtor
+    bool try_push(const T& value) {
+        std::size_t t = tail.load(std::memory_order_relaxed);
+        std::size_t next = t + 1 == slots.size() ? 0 : t + 1;
+        if (next == head.load(std::memory_order_acquire)) return false;
+        slots[t] = value;
+        tail.store(next, std::memory_order_release);
+        return true;
+    }
+
+    // Só o consumidor
+    bool try_pop(T& out) {
+        std::size_t h = head.load(std::memory_order_relaxed);
+        if (h == tail.load(std::memory_order_acquire)) return false;
+        using std::swap;
+        swap(out, slots[h]);
+        head.store(h + 1 == slots.size() ? 0 : h + 1, std::memory_order_release);
+        return true;
+    }
+
+private:
+    std::vector<T> slots;
+    alignas(64) std::atomic<std::size_t> head{0};  // próximo a ler
+    alignas(64) std::atomic<std::size_t> tail{0};  // próximo a escrever
+};
+
+#endif
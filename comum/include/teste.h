@@ -0,0 +1,35 @@
+#ifndef TESTE_H
+#define TESTE_H
+
+#include <iostream>
+#include <string>
+
+/**
+ * Verificações dos testes de todos os módulos
+ *
+ * Objetivo:
+ *   Os testes são executáveis simples (sem framework): cada check()
+ *   imprime [OK] ou [FALHA] com a mensagem, e test_summary() imprime o
+ *   resumo no final do main e devolve o código de saída, diferente de
+ *   zero se algum check falhou.
+ *
+ *     check(x == 3, "x vale 3");
+ *     return test_summary();
+ */
+
+inline int& test_failures() {
+    static int failures = 0;
+    return failures;
+}
+
+inline void check(bool condition, const std::string& message) {
+    std::cout << (condition ? "[OK]    " : "[FALHA] ") << message << std::endl;
+    if (!condition) ++test_failures();
+}
+
+inline int test_summary(const char* success_message = "TODOS OS TESTES PASSARAM!") {
+    std::cout << (test_failures() == 0 ? success_message : "HÁ TESTES FALHANDO!") << std::endl;
+    return test_failures() == 0 ? 0 : 1;
+}
+
+#endif
@@ -0,0 +1,225 @@
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * Pool de threads com roubo de tarefas (work stealing)
+ *
+ * Objetivo:
+ *   Compartilhar um conjunto fixo de threads entre os algoritmos
+ *   paralelos do repositório. Cada worker tem a sua própria deque:
+ *   tarefas criadas por um worker vão para o fim da deque dele e ele
+ *   as consome em ordem LIFO (boa localidade); um worker sem trabalho
+ *   rouba do início da deque de outro (as tarefas mais antigas, em
+ *   geral as maiores). Tarefas vindas de fora do pool são distribuídas
+ *   em rodízio.
+ *
+ *   TaskGroup agrupa tarefas e permite esperar por elas de dentro de
+ *   uma tarefa: enquanto espera, a thread executa trabalho pendente,
+ *   então paralelismo aninhado não trava o pool.
+ *
+ * Complexidade:
+ *   - submit / pop: O(1) com uma trava por deque
+ */
+
+class ThreadPool {
+public:
+    explicit ThreadPool(unsigned num_threads = 0) {
+        if (num_threads == 0) num_threads = std::max(1u, std::thread::hardware_concurrency());
+        num_workers = num_threads;
+        for (unsigned i = 0; i < num_threads; ++i) {
+            queues.push_back(std::unique_ptr<WorkerQueue>(new WorkerQueue()));
+        }
+        for (unsigned i = 0; i < num_threads; ++i) {
+            threads.emplace_back(&ThreadPool::worker_loop, this, i);
+        }
+    }
+
+    ~ThreadPool() {
+        wait_idle();
+        {
+            std::lock_guard<std::mutex> lock(sleep_mutex);
+            stopping = true;
+        }
+        wake.notify_all();
+        for (std::thread& thread : threads) thread.join();
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    unsigned size() const { return num_workers; }
+
+    void submit(std::function<void()> task) {
+        unsigned id = current_worker();
+        if (id == NOT_A_WORKER) {
+            id = next_queue.fetch_add(1, std::memory_order_relaxed) % size();
+        }
+        pending.fetch_add(1, std::memory_order_relaxed);
+        {
+            std::lock_guard<std::mutex> lock(queues[id]->mutex);
+            queues[id]->tasks.push_back(std::move(task));
+        }
+        {
+            std::lock_guard<std::mutex> lock(sleep_mutex);
+            ++queued;
+        }
+        wake.notify_one();
+    }
+
+    // Espera todas as tarefas terminarem (não chamar de dentro do pool)
+    void wait_idle() {
+        std::unique_lock<std::mutex> lock(sleep_mutex);
+        idle.wait(lock, [this] { return pending.load(std::memory_order_acquire) == 0; });
+    }
+
+    // Executa uma tarefa pendente na thread atual, se houver
+    bool try_run_one() {
+        std::function<void()> task;
+        unsigned id = current_worker();
+        if (!take(id == NOT_A_WORKER ? 0 : id, task)) return false;
+        execute(task);
+        return true;
+    }
+
+private:
+    static constexpr unsigned NOT_A_WORKER = static_cast<unsigned>(-1);
+
+    struct alignas(64) WorkerQueue {
+        std::mutex mutex;
+        std::deque<std::function<void()>> tasks;
+    };
+
+    std::vector<std::unique_ptr<WorkerQueue>> queues;
+    std::vector<std::thread> threads;
+    unsigned num_workers;  // fixo antes de criar as threads: elas leem enquanto threads cresce
+    std::atomic<std::size_t> pending{0};  // submetidas e ainda não concluídas
+    std::size_t queued = 0;               // nas deques (protegido por sleep_mutex)
+    bool stopping = false;
+    std::atomic<unsigned> next_queue{0};
+    std::mutex sleep_mutex;
+    std::condition_variable wake;
+    std::condition_variable idle;
+
+    struct WorkerIdentity {
+        const ThreadPool* pool = nullptr;
+        unsigned id = NOT_A_WORKER;
+    };
+
+    static WorkerIdentity& identity() {
+        static thread_local WorkerIdentity self;
+        return self;
+    }
+
+    unsigned current_worker() const {
+        return identity().pool == this ? identity().id : NOT_A_WORKER;
+    }
+
+    // Própria deque pelo fim; senão rouba o início das outras
+    bool take(unsigned id, std::function<void()>& task) {
+        {
+            WorkerQueue& own = *queues[id];
+            std::lock_guard<std::mutex> lock(own.mutex);
+            if (!own.tasks.empty()) {
+                task = std::move(own.tasks.back());
+                own.tasks.pop_back();
+                mark_taken();
+                return true;
+            }
+        }
+        for (unsigned k = 1; k < size(); ++k) {
+            WorkerQueue& victim = *queues[(id + k) % size()];
+            std::lock_guard<std::mutex> lock(victim.mutex);
+            if (!victim.tasks.empty()) {
+                task = std::move(victim.tasks.front());
+                victim.tasks.pop_front();
+                mark_taken();
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void mark_taken() {
+        std::lock_guard<std::mutex> lock(sleep_mutex);
+        --queued;
+    }
+
+    void execute(std::function<void()>& task) {
+        task();
+        task = nullptr;
+        if (pending.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            std::lock_guard<std::mutex> lock(sleep_mutex);
+            idle.notify_all();
+        }
+    }
+
+    void worker_loop(unsigned id) {
+        identity().pool = this;
+        identity().id = id;
+        std::function<void()> task;
+        while (true) {
+            if (take(id, task)) {
+                execute(task);
+                continue;
+            }
+            std::unique_lock<std::mutex> lock(sleep_mutex);
+            wake.wait(lock, [this] { return queued > 0 || stopping; });
+            if (stopping && queued == 0) return;
+        }
+    }
+};
+
+class TaskGroup {
+public:
+    explicit TaskGroup(ThreadPool& pool) : pool(pool) {}
+    ~TaskGroup() { wait(); }
+
+    void run(std::function<void()> task) {
+        remaining.fetch_add(1, std::memory_order_relaxed);
+        pool.submit([this, task = std::move(task)] {
+            task();
+            remaining.fetch_sub(1, std::memory_order_release);
+        });
+    }
+
+    // Ajuda a executar tarefas pendentes enquanto o grupo não termina
+    void wait() {
+        while (remaining.load(std::memory_order_acquire) != 0) {
+            if (!pool.try_run_one()) std::this_thread::yield();
+        }
+    }
+
+private:
+    ThreadPool& pool;
+    std::atomic<std::size_t> remaining{0};
+};
+
+// fn(lo, hi) para blocos de até grain índices de [begin, end)
+template <typename Fn>
+void parallel_for(ThreadPool& pool, std::size_t begin, std::size_t end, std::size_t grain, Fn fn) {
+    if (begin >= end) return;
+    grain = std::max<std::size_t>(1, grain);
+    if (end - begin <= grain || pool.size() == 1) {
+        fn(begin, end);
+        return;
+    }
+    TaskGroup group(pool);
+    for (std::size_t lo = begin; lo < end; lo += grain) {
+        std::size_t hi = std::min(end, lo + grain);
+        group.run([&fn, lo, hi] { fn(lo, hi); });
+    }
+    group.wait();
+}
+
+#endif
@@ -0,0 +1,81 @@
+#ifndef ALT_H
+#define ALT_H
+
+#include "grafo_csr.h"
+#include "filas_prioridade.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * ALT: A* com marcos (landmarks) e desigualdade triangular
+ *
+ * Objetivo:
+ *   Pré-calcular, para alguns marcos L, as distâncias d(L, v) e d(v, L)
+ *   de todos os vértices. Numa consulta s -> t a desigualdade
+ *   triangular dá limites inferiores para d(v, t):
+ *     d(v, t) >= d(L, t) - d(L, v)     e     d(v, t) >= d(v, L) - d(t, L)
+ *   O maior deles é um potencial consistente para o A*, que passa a
+ *   expandir quase só os vértices na direção de t.
+ *
+ *   Os marcos são escolhidos pela heurística "mais distante": cada novo
+ *   marco é o vértice alcançável mais longe dos marcos já escolhidos.
+ *   As tabelas são guardadas em 32 bits por entrada; distâncias que não
+ *   cabem viram "desconhecidas" e simplesmente não contribuem com limite.
+ *
+ * Complexidade:
+ *   - Pré-processamento: 2k execuções de Dijkstra (k marcos)
+ *   - Espaço: 2k entradas de 32 bits por vértice
+ *   - Consulta: O(E log V) no pior caso, tipicamente uma fração pequena
+ *     do grafo
+ */
+
+class Landmarks {
+public:
+    Landmarks() = default;
+
+    static Landmarks build(const CSRGraph& graph, unsigned count, Vertex first_seed = 0);
+    static Landmarks load(const std::string& path);
+    void save(const std::string& path) const;
+
+    unsigned count() const { return static_cast<unsigned>(landmarks.size()); }
+    Vertex num_vertices() const { return vertices; }
+    const std::vector<Vertex>& vertices_list() const { return landmarks; }
+
+    // Limite inferior para d(v, t)
+    Distance lower_bound(Vertex v, Vertex t) const;
+
+private:
+    static constexpr std::uint32_t UNKNOWN = 0xFFFFFFFFu;
+
+    Vertex vertices = 0;
+    std::vector<Vertex> landmarks;
+    // Layout por vértice: from_landmark[v * k + i] = d(L_i, v)
+    std::vector<std::uint32_t> from_landmark;
+    // to_landmark[v * k + i] = d(v, L_i)
+    std::vector<std::uint32_t> to_landmark;
+};
+
+class ALTQuery {
+public:
+    ALTQuery(const CSRGraph& graph, const Landmarks& landmarks);
+
+    Distance run(Vertex source, Vertex target);
+
+    std::vector<Vertex> path() const;
+    std::uint64_t settled_count() const { return settled; }
+
+private:
+    const CSRGraph* graph;
+    const Landmarks* landmarks;
+    std::vector<Distance> dist;
+    std::vector<Distance> potential;
+    std::vector<Vertex> pred;
+    std::vector<std::uint32_t> stamp;
+    std::uint32_t generation;
+    BinaryHeapQueue queue;
+    Vertex last_target;
+    std::uint64_t settled;
+};
+
+#endif
@@ -0,0 +1,55 @@
+#ifndef ARQUIVO_GRAFO_H
+#define ARQUIVO_GRAFO_H
+
+#include "grafo_csr.h"
+#include <string>
+
+/**
+ * Formato binário de CSR e conversão de arquivos texto
+ *
+ * Objetivo:
+ *   Converter uma única vez grafos em texto para um arquivo binário
+ *   que já está no layout de CSRGraph, e depois abrir esse arquivo
+ *   com mmap: a "carga" é instantânea, as páginas só são lidas quando
+ *   tocadas e vários processos compartilham o mesmo cache de páginas.
+ *
+ *   Layout (little-endian, tudo alinhado a 8 bytes):
+ *     magic "CSRGRAF1" | num_vertices u64 | num_edges u64 | reservado u64
+ *     offsets  (num_vertices + 1) x u64
+ *     targets  num_edges x u32  (+ preenchimento até múltiplo de 8)
+ *     weights  num_edges x u32
+ *
+ *   Formatos texto aceitos:
+ *     DIMACS .gr: "p sp n m" e arestas "a u v w" com vértices de 1 a n
+ *     Lista de arestas: "u v [w]" por linha, vértices a partir de 0,
+ *     peso 1 quando omitido; linhas com '#' ou '%' são comentários
+ *
+ *   O conversor lê o texto em blocos grandes com fread e faz duas
+ *   passadas: a primeira conta graus, a segunda escreve cada aresta
+ *   direto na sua posição final dentro do arquivo de saída mapeado.
+ *   A memória usada é O(V), independente do número de arestas.
+ *
+ * Complexidade:
+ *   - Conversão: O(V + E) com duas leituras sequenciais do texto
+ *   - Carga: O(V + E) verificando o arquivo; O(1) (só mmap) sem
+ *     verificar, com as páginas lidas sob demanda
+ */
+
+enum class TextGraphFormat { Dimacs, EdgeList };
+
+// A saída é montada em binary_path + ".tmp" e renomeada no fim; se a
+// conversão falhar, binary_path fica como estava
+void convert_text_graph(const std::string& text_path, TextGraphFormat format,
+                        const std::string& binary_path);
+
+void save_binary_graph(const CSRGraph& graph, const std::string& binary_path);
+
+// O CSRGraph devolvido mantém o mapeamento vivo enquanto existir cópia dele.
+// Com verify, uma passada O(V + E) confere que os offsets não decrescem e
+// que todo destino é < n, e arquivos corrompidos viram exceção em vez de
+// leituras fora dos limites nas consultas. verify = false mantém a carga
+// O(1), mas só serve para arquivos confiáveis (gerados por este módulo e
+// não alterados depois)
+CSRGraph map_binary_graph(const std::string& binary_path, bool verify = true);
+
+#endif
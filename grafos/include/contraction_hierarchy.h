@@ -0,0 +1,130 @@
+#ifndef CONTRACTION_HIERARCHY_H
+#define CONTRACTION_HIERARCHY_H
+
+#include "grafo_csr.h"
+#include "filas_prioridade.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * Hierarquias de contração (Contraction Hierarchies)
+ *
+ * Objetivo:
+ *   Pré-processar um grafo estático para consultas s -> t muito
+ *   rápidas. Os vértices são contraídos um a um, em ordem de
+ *   importância crescente; ao remover v, cada par u -> v -> x cujo
+ *   caminho mínimo passa por v vira um atalho u -> x (a menos que uma
+ *   busca de testemunha encontre um caminho alternativo tão curto).
+ *
+ *   A ordem vem de uma fila com prioridade = diferença de arestas
+ *   (atalhos criados - arestas removidas) + vizinhos já contraídos,
+ *   reavaliada de forma preguiçosa antes de cada contração.
+ *
+ *   O resultado são dois CSR compactos com arestas só "para cima":
+ *     upward:   u -> v com rank(v) > rank(u)          (busca a partir de s)
+ *     downward: v -> u para cada aresta u -> v com
+ *               rank(u) > rank(v)                     (busca a partir de t)
+ *   Uma consulta são duas buscas ascendentes que se encontram no
+ *   vértice de maior rank do caminho ótimo.
+ *
+ * Complexidade:
+ *   - Pré-processamento: depende da ordem; quase linear em malhas viárias
+ *   - Consulta: poucas centenas de vértices fixados em malhas viárias
+ *   - Espaço: O(V + E + atalhos)
+ */
+
+class ContractionHierarchy {
+public:
+    ContractionHierarchy() = default;
+
+    static ContractionHierarchy build(const CSRGraph& graph);
+    static ContractionHierarchy load(const std::string& path);
+    void save(const std::string& path) const;
+
+    Vertex num_vertices() const { return static_cast<Vertex>(ranks.size()); }
+    Vertex rank(Vertex v) const { return ranks[v]; }
+    std::uint64_t num_shortcuts() const { return shortcuts; }
+
+    const CSRGraph& upward() const { return up; }
+    const CSRGraph& downward() const { return down; }
+
+private:
+    std::vector<Vertex> ranks;
+    CSRGraph up;
+    CSRGraph down;
+    std::uint64_t shortcuts = 0;
+};
+
+// Busca ascendente com "stall-on-demand": um vértice u não expande
+// suas arestas se algum vizinho de rank maior já prova que dist[u]
+// não é mínima (aresta no sentido oposto, guardada em stall_graph).
+class CHSearch {
+public:
+    CHSearch(const CSRGraph& graph, const CSRGraph& stall_graph);
+
+    void start(Vertex source);
+    bool empty() const { return queue.empty(); }
+    Distance top_key() const { return queue.top_key(); }
+
+    // Fixa o próximo vértice; devolve NO_VERTEX se a entrada era
+    // obsoleta ou se o vértice foi podado pelo stall-on-demand.
+    Vertex settle_next();
+    void run_to_completion();
+
+    bool reached(Vertex v) const { return stamp[v] == generation; }
+    Distance distance(Vertex v) const { return reached(v) ? dist[v] : INF_DISTANCE; }
+    const std::vector<Vertex>& settled_vertices() const { return settled; }
+
+private:
+    const CSRGraph* graph;
+    const CSRGraph* stall_graph;
+    std::vector<Distance> dist;
+    std::vector<std::uint32_t> stamp;
+    std::uint32_t generation;
+    BinaryHeapQueue queue;
+    std::vector<Vertex> settled;
+};
+
+class CHQuery {
+public:
+    explicit CHQuery(const ContractionHierarchy& ch);
+
+    Distance run(Vertex source, Vertex target);
+    std::uint64_t settled_count() const { return settled; }
+
+private:
+    CHSearch forward;
+    CHSearch backward;
+    std::uint64_t settled;
+};
+
+// Tabela de distâncias origens x destinos com baldes: cada busca
+// reversa a partir de um destino deixa (destino, distância) nos
+// vértices que fixou; cada busca a partir de uma origem só precisa
+// varrer os baldes dos vértices que ela mesma fixou.
+class CHManyToMany {
+public:
+    explicit CHManyToMany(const ContractionHierarchy& ch);
+
+    // table[i * targets.size() + j] = d(sources[i], targets[j])
+    void run(const std::vector<Vertex>& sources, const std::vector<Vertex>& targets,
+             std::vector<Distance>& table);
+
+private:
+    struct BucketEntry {
+        Vertex vertex;
+        std::uint32_t target_index;
+        Distance distance;
+    };
+
+    CHSearch forward;
+    CHSearch backward;
+    std::vector<BucketEntry> entries;
+    std::vector<std::uint64_t> bucket_begin;
+    std::vector<std::uint64_t> bucket_end;
+    std::vector<std::uint32_t> bucket_stamp;
+    std::uint32_t generation;
+};
+
+#endif
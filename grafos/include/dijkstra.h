@@ -0,0 +1,139 @@
+#ifndef DIJKSTRA_H
+#define DIJKSTRA_H
+
+#include "grafo_csr.h"
+#include "filas_prioridade.h"
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+/**
+ * Consulta de Dijkstra reutilizável
+ *
+ * Objetivo:
+ *   Responder muitas consultas de caminho mínimo (SSSP) sobre o mesmo
+ *   CSRGraph sem realocar nada entre uma consulta e outra. Os vetores
+ *   de distância, predecessor e a fila ficam vivos no objeto; em vez de
+ *   reinicializar O(V) posições a cada consulta, cada vértice guarda o
+ *   número da geração em que foi tocado pela última vez (carimbo).
+ *   Posição com carimbo antigo vale como "infinito".
+ *
+ *   A fila de prioridade é um parâmetro de template (ver
+ *   filas_prioridade.h); DijkstraQuery usa o heap binário.
+ *
+ * Complexidade:
+ *   - Tempo: O(E log V) por consulta com heap binário; reinicialização
+ *     O(1) amortizada
+ *   - Espaço: O(V) reaproveitado entre consultas
+ */
+
+template <typename Queue>
+class BasicDijkstraQuery {
+public:
+    explicit BasicDijkstraQuery(const CSRGraph& graph)
+        : graph(&graph), dist(graph.num_vertices()), pred(graph.num_vertices()),
+          stamp(graph.num_vertices(), 0), generation(0),
+          track_predecessors(false), last_source(NO_VERTEX), settled(0) {
+        queue.prepare(graph);
+    }
+
+    void set_track_predecessors(bool track) { track_predecessors = track; }
+
+    void run(Vertex src) { run(src, NO_VERTEX); }
+
+    // Consulta ponto a ponto: para assim que target sai da fila,
+    // devolvendo a distância até ele (INF_DISTANCE se inalcançável).
+    // Só os vértices fixados até esse momento têm distância final.
+    Distance run(Vertex src, Vertex target) {
+        start_generation();
+        last_source = src;
+
+        stamp[src] = generation;
+        dist[src] = 0;
+        pred[src] = NO_VERTEX;
+        queue.push(src, 0);
+
+        while (!queue.empty()) {
+            std::pair<Distance, Vertex> top = queue.pop();
+            Distance d = top.first;
+            Vertex u = top.second;
+
+            // Entrada obsoleta (o vértice já saiu com distância menor)
+            if (d > dist[u]) continue;
+            ++settled;
+            if (u == target) return d;
+
+            for (std::uint64_t e = graph->edge_begin(u); e < graph->edge_end(u); ++e) {
+                Vertex v = graph->target(e);
+                Distance nd = d + graph->weight(e);
+
+                if (stamp[v] != generation || nd < dist[v]) {
+                    stamp[v] = generation;
+                    dist[v] = nd;
+                    if (track_predecessors) pred[v] = u;
+                    queue.push(v, nd);
+                }
+            }
+        }
+        return INF_DISTANCE;
+    }
+
+    Distance distance(Vertex v) const { return reached(v) ? dist[v] : INF_DISTANCE; }
+
+    Vertex predecessor(Vertex v) const {
+        return (track_predecessors && reached(v)) ? pred[v] : NO_VERTEX;
+    }
+
+    bool reached(Vertex v) const { return stamp[v] == generation; }
+
+    // Caminho source -> v (vazio se v não foi alcançado)
+    std::vector<Vertex> path_to(Vertex v) const {
+        std::vector<Vertex> path;
+        if (!track_predecessors || !reached(v)) return path;
+
+        for (Vertex cur = v; cur != NO_VERTEX; cur = pred[cur]) {
+            path.push_back(cur);
+        }
+        std::reverse(path.begin(), path.end());
+        return path;
+    }
+
+    void copy_distances(std::vector<Distance>& out) const {
+        out.resize(dist.size());
+        for (std::size_t v = 0; v < dist.size(); ++v) {
+            out[v] = stamp[v] == generation ? dist[v] : INF_DISTANCE;
+        }
+    }
+
+    Vertex source() const { return last_source; }
+    std::uint64_t settled_count() const { return settled; }
+
+private:
+    const CSRGraph* graph;
+    std::vector<Distance> dist;
+    std::vector<Vertex> pred;
+    std::vector<std::uint32_t> stamp;
+    std::uint32_t generation;
+    Queue queue;
+    bool track_predecessors;
+    Vertex last_source;
+    std::uint64_t settled;
+
+    void start_generation() {
+        // Ao dar a volta no contador, carimbos antigos poderiam coincidir
+        // com a nova geração: só nesse caso zeramos o vetor inteiro.
+        if (++generation == 0) {
+            std::fill(stamp.begin(), stamp.end(), 0);
+            generation = 1;
+        }
+        queue.clear();
+        settled = 0;
+    }
+};
+
+using DijkstraQuery = BasicDijkstraQuery<BinaryHeapQueue>;
+using DialDijkstraQuery = BasicDijkstraQuery<DialQueue>;
+using RadixDijkstraQuery = BasicDijkstraQuery<RadixHeapQueue>;
+using QuaternaryDijkstraQuery = BasicDijkstraQuery<QuaternaryHeapQueue>;
+
+#endif
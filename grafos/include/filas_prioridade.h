@@ -0,0 +1,232 @@
+#ifndef FILAS_PRIORIDADE_H
+#define FILAS_PRIORIDADE_H
+
+#include "grafo_csr.h"
+#include <algorithm>
+#include <functional>
+#include <utility>
+#include <vector>
+
+/**
+ * Filas de prioridade para Dijkstra com pesos inteiros não negativos
+ *
+ * Objetivo:
+ *   Oferecer backends intercambiáveis para BasicDijkstraQuery. Todos
+ *   expõem a mesma interface:
+ *     prepare(grafo)  -> aloca buffers uma única vez
+ *     clear()         -> esvazia a fila entre consultas
+ *     push(v, d)      -> insere v com chave d (ou diminui a chave)
+ *     pop()           -> remove o par (d, v) de menor chave
+ *     empty()
+ *   BinaryHeapQueue e QuaternaryHeapQueue também expõem top_key(), usado
+ *   pelo critério de parada das buscas bidirecionais.
+ *   Backends "preguiçosos" aceitam duplicatas de v; quem consome a
+ *   fila descarta entradas com d maior que a distância atual.
+ *
+ * Complexidade (por operação):
+ *   - BinaryHeapQueue: O(log n) push/pop, com duplicatas
+ *   - DialQueue:       O(1) push, pop amortizado O(C) por consulta
+ *                      (C = maior peso); bom para C pequeno
+ *   - RadixHeapQueue:  O(1) push, pop amortizado O(log C)
+ *   - QuaternaryHeapQueue: O(log4 n) com decrease-key, sem duplicatas
+ */
+
+class BinaryHeapQueue {
+public:
+    void prepare(const CSRGraph&) {}
+    void clear() { heap.clear(); }
+    bool empty() const { return heap.empty(); }
+    Distance top_key() const { return heap.front().first; }
+
+    void push(Vertex v, Distance d) {
+        heap.push_back({d, v});
+        std::push_heap(heap.begin(), heap.end(), std::greater<std::pair<Distance, Vertex>>());
+    }
+
+    std::pair<Distance, Vertex> pop() {
+        std::pop_heap(heap.begin(), heap.end(), std::greater<std::pair<Distance, Vertex>>());
+        std::pair<Distance, Vertex> top = heap.back();
+        heap.pop_back();
+        return top;
+    }
+
+private:
+    std::vector<std::pair<Distance, Vertex>> heap;
+};
+
+// Fila de Dial: C+1 baldes circulares, um por valor de distância.
+// Como toda chave inserida fica em [atual, atual + C], o índice
+// d % (C+1) nunca colide com chaves ainda pendentes.
+class DialQueue {
+public:
+    void prepare(const CSRGraph& graph) {
+        buckets.assign(static_cast<std::size_t>(graph.max_weight()) + 1, {});
+        current = 0;
+        count = 0;
+    }
+
+    void clear() {
+        if (count > 0) {
+            for (auto& bucket : buckets) bucket.clear();
+        }
+        current = 0;
+        count = 0;
+    }
+
+    bool empty() const { return count == 0; }
+
+    void push(Vertex v, Distance d) {
+        buckets[d % buckets.size()].push_back(v);
+        ++count;
+    }
+
+    std::pair<Distance, Vertex> pop() {
+        std::size_t index = current % buckets.size();
+        while (buckets[index].empty()) {
+            ++current;
+            if (++index == buckets.size()) index = 0;
+        }
+        Vertex v = buckets[index].back();
+        buckets[index].pop_back();
+        --count;
+        return {current, v};
+    }
+
+private:
+    std::vector<std::vector<Vertex>> buckets;
+    Distance current = 0;
+    std::size_t count = 0;
+};
+
+// Radix heap monotônico: o balde i guarda chaves que diferem da última
+// chave removida a partir do bit i-1. Cada elemento desce de balde no
+// máximo 64 vezes ao longo da consulta.
+class RadixHeapQueue {
+public:
+    void prepare(const CSRGraph&) { clear(); }
+
+    void clear() {
+        if (count > 0) {
+            for (auto& bucket : buckets) bucket.clear();
+        }
+        last = 0;
+        count = 0;
+    }
+
+    bool empty() const { return count == 0; }
+
+    void push(Vertex v, Distance d) {
+        buckets[bucket_index(d)].push_back({d, v});
+        ++count;
+    }
+
+    std::pair<Distance, Vertex> pop() {
+        if (buckets[0].empty()) {
+            std::size_t i = 1;
+            while (buckets[i].empty()) ++i;
+
+            // Nova referência = menor chave do primeiro balde não vazio;
+            // redistribui o balde inteiro em baldes menores.
+            Distance new_last = buckets[i][0].first;
+            for (const auto& item : buckets[i]) new_last = std::min(new_last, item.first);
+            last = new_last;
+            for (const auto& item : buckets[i]) {
+                buckets[bucket_index(item.first)].push_back(item);
+            }
+            buckets[i].clear();
+        }
+        std::pair<Distance, Vertex> top = buckets[0].back();
+        buckets[0].pop_back();
+        --count;
+        return top;
+    }
+
+private:
+    std::vector<std::pair<Distance, Vertex>> buckets[65];
+    Distance last = 0;
+    std::size_t count = 0;
+
+    std::size_t bucket_index(Distance d) const {
+        return d == last ? 0 : 64 - __builtin_clzll(d ^ last);
+    }
+};
+
+// Heap 4-ário indexado: cada vértice aparece no máximo uma vez e
+// push() de um vértice presente vira decrease-key. Filhos de i ficam
+// em 4i+1..4i+4, quase sempre na mesma linha de cache.
+class QuaternaryHeapQueue {
+public:
+    void prepare(const CSRGraph& graph) {
+        position.assign(graph.num_vertices(), NOT_IN_HEAP);
+        heap.clear();
+    }
+
+    void clear() {
+        for (const auto& item : heap) position[item.second] = NOT_IN_HEAP;
+        heap.clear();
+    }
+
+    bool empty() const { return heap.empty(); }
+    Distance top_key() const { return heap.front().first; }
+
+    void push(Vertex v, Distance d) {
+        std::size_t i = position[v];
+        if (i == NOT_IN_HEAP) {
+            i = heap.size();
+            heap.push_back({d, v});
+        } else if (d >= heap[i].first) {
+            return;
+        }
+        sift_up(i, {d, v});
+    }
+
+    std::pair<Distance, Vertex> pop() {
+        std::pair<Distance, Vertex> top = heap[0];
+        position[top.second] = NOT_IN_HEAP;
+        std::pair<Distance, Vertex> last = heap.back();
+        heap.pop_back();
+        if (!heap.empty()) sift_down(0, last);
+        return top;
+    }
+
+private:
+    static constexpr std::size_t NOT_IN_HEAP = static_cast<std::size_t>(-1);
+
+    std::vector<std::pair<Distance, Vertex>> heap;
+    std::vector<std::size_t> position;
+
+    void place(std::size_t i, const std::pair<Distance, Vertex>& item) {
+        heap[i] = item;
+        position[item.second] = i;
+    }
+
+    void sift_up(std::size_t i, std::pair<Distance, Vertex> item) {
+        while (i > 0) {
+            std::size_t parent = (i - 1) / 4;
+            if (heap[parent].first <= item.first) break;
+            place(i, heap[parent]);
+            i = parent;
+        }
+        place(i, item);
+    }
+
+    void sift_down(std::size_t i, std::pair<Distance, Vertex> item) {
+        const std::size_t n = heap.size();
+        while (true) {
+            std::size_t first_child = 4 * i + 1;
+            if (first_child >= n) break;
+
+            std::size_t best = first_child;
+            std::size_t last_child = std::min(first_child + 4, n);
+            for (std::size_t c = first_child + 1; c < last_child; ++c) {
+                if (heap[c].first < heap[best].first) best = c;
+            }
+            if (heap[best].first >= item.first) break;
+            place(i, heap[best]);
+            i = best;
+        }
+        place(i, item);
+    }
+};
+
+#endif
@@ -0,0 +1,93 @@
+#ifndef GRAFO_CSR_H
+#define GRAFO_CSR_H
+
+#include <cstdint>
+#include <iosfwd>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+
+/**
+ * Grafo em formato CSR (Compressed Sparse Row)
+ *
+ * Objetivo:
+ *   Guardar a lista de adjacência em três vetores contíguos:
+ *   offsets[u]..offsets[u+1] delimita as arestas de saída de u
+ *   dentro de targets/weights. Uma varredura de vizinhos vira uma
+ *   leitura sequencial em vez de um salto para outro bloco de heap.
+ *
+ *   O grafo só enxerga ponteiros para os três vetores; quem é dono da
+ *   memória (vetores próprios ou um arquivo mapeado com mmap, ver
+ *   arquivo_grafo.h) fica num shared_ptr. Cópias são baratas e
+ *   compartilham os mesmos dados imutáveis.
+ *
+ * Complexidade:
+ *   - Construção: O(V + E) (ordenação por contagem pela origem)
+ *   - Espaço: O(V + E)
+ */
+
+using Vertex = std::uint32_t;
+using Weight = std::uint32_t;
+using Distance = std::uint64_t;
+
+constexpr Vertex NO_VERTEX = std::numeric_limits<Vertex>::max();
+constexpr Distance INF_DISTANCE = std::numeric_limits<Distance>::max();
+
+struct Edge {
+    Vertex from;
+    Vertex to;
+    Weight weight;
+};
+
+class CSRGraph {
+public:
+    CSRGraph() = default;
+    CSRGraph(Vertex num_vertices, const std::vector<Edge>& edges);
+
+    // Converte a lista de adjacência usada em Dijkstra-modesto.cpp
+    // (pares (vizinho, peso) por vértice).
+    static CSRGraph from_adjacency(const std::vector<std::vector<std::pair<int, int>>>& adj);
+
+    // Grafo sobre memória externa; owner mantém os dados vivos
+    static CSRGraph view(Vertex num_vertices, std::uint64_t num_edges,
+                         const std::uint64_t* offsets, const Vertex* targets,
+                         const Weight* weights, std::shared_ptr<const void> owner);
+
+    Vertex num_vertices() const { return vertices; }
+    std::uint64_t num_edges() const { return edges; }
+
+    std::uint64_t edge_begin(Vertex u) const { return offsets[u]; }
+    std::uint64_t edge_end(Vertex u) const { return offsets[u + 1]; }
+    Vertex target(std::uint64_t e) const { return targets[e]; }
+    Weight weight(std::uint64_t e) const { return weights[e]; }
+
+    Weight max_weight() const;
+    CSRGraph reversed() const;
+
+    // Serialização crua dos três vetores (usada pelos índices derivados)
+    void write(std::ostream& out) const;
+    static CSRGraph read(std::istream& in);
+
+    const std::uint64_t* offsets_data() const { return offsets; }
+    const Vertex* targets_data() const { return targets; }
+    const Weight* weights_data() const { return weights; }
+
+private:
+    struct Storage {
+        std::vector<std::uint64_t> offsets;
+        std::vector<Vertex> targets;
+        std::vector<Weight> weights;
+    };
+
+    Vertex vertices = 0;
+    std::uint64_t edges = 0;
+    const std::uint64_t* offsets = nullptr;
+    const Vertex* targets = nullptr;
+    const Weight* weights = nullptr;
+    std::shared_ptr<const void> owner;
+
+    void adopt(std::shared_ptr<Storage> storage);
+};
+
+#endif
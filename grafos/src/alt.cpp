@@ -0,0 +1,219 @@
+#include "alt.h"
+#include "dijkstra.h"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+namespace {
+
+const char LANDMARKS_MAGIC[8] = {'A', 'L', 'T', 'L', 'M', 'K', '0', '1'};
+
+std::uint32_t to_table(Distance d) {
+    return d >= 0xFFFFFFFFull ? 0xFFFFFFFFu : static_cast<std::uint32_t>(d);
+}
+
+}
+
+Landmarks Landmarks::build(const CSRGraph& graph, unsigned count, Vertex first_seed) {
+    Landmarks result;
+    result.vertices = graph.num_vertices();
+    const Vertex n = graph.num_vertices();
+    if (n == 0 || count == 0) return result;
+
+    CSRGraph reverse = graph.reversed();
+    DijkstraQuery forward_query(graph);
+    DijkstraQuery reverse_query(reverse);
+
+    // score[v] = menor distância de v a partir dos marcos já escolhidos
+    std::vector<Distance> score(n, INF_DISTANCE);
+    std::vector<Distance> dist;
+
+    forward_query.run(first_seed);
+    forward_query.copy_distances(dist);
+    Vertex next = first_seed;
+    for (Vertex v = 0; v < n; ++v) {
+        if (dist[v] != INF_DISTANCE && dist[v] > dist[next]) next = v;
+    }
+
+    std::vector<std::vector<std::uint32_t>> from(count), to(count);
+    while (result.landmarks.size() < count) {
+        result.landmarks.push_back(next);
+        std::size_t i = result.landmarks.size() - 1;
+
+        forward_query.run(next);
+        forward_query.copy_distances(dist);
+        from[i].resize(n);
+        for (Vertex v = 0; v < n; ++v) {
+            from[i][v] = to_table(dist[v]);
+            score[v] = std::min(score[v], dist[v]);
+        }
+
+        reverse_query.run(next);
+        reverse_query.copy_distances(dist);
+        to[i].resize(n);
+        for (Vertex v = 0; v < n; ++v) to[i][v] = to_table(dist[v]);
+
+        // Próximo marco: vértice alcançável mais distante dos marcos atuais
+        Distance farthest = 0;
+        for (Vertex v = 0; v < n; ++v) {
+            if (score[v] != INF_DISTANCE && score[v] > farthest) {
+                farthest = score[v];
+                next = v;
+            }
+        }
+        if (farthest == 0) break;
+    }
+
+    // Transpõe para o layout por vértice usado nas consultas
+    std::size_t k = result.landmarks.size();
+    result.from_landmark.resize(static_cast<std::size_t>(n) * k);
+    result.to_landmark.resize(static_cast<std::size_t>(n) * k);
+    for (Vertex v = 0; v < n; ++v) {
+        for (std::size_t i = 0; i < k; ++i) {
+            result.from_landmark[v * k + i] = from[i][v];
+            result.to_landmark[v * k + i] = to[i][v];
+        }
+    }
+    return result;
+}
+
+Distance Landmarks::lower_bound(Vertex v, Vertex t) const {
+    const std::size_t k = landmarks.size();
+    if (k == 0) return 0;  // sem marcos as tabelas são vazias: A* vira Dijkstra
+    const std::uint32_t* from_v = &from_landmark[v * k];
+    const std::uint32_t* from_t = &from_landmark[t * k];
+    const std::uint32_t* to_v = &to_landmark[v * k];
+    const std::uint32_t* to_t = &to_landmark[t * k];
+
+    Distance bound = 0;
+    for (std::size_t i = 0; i < k; ++i) {
+        // d(L, t) - d(L, v)
+        if (from_v[i] != UNKNOWN && from_t[i] != UNKNOWN && from_t[i] > from_v[i]) {
+            bound = std::max<Distance>(bound, from_t[i] - from_v[i]);
+        }
+        // d(v, L) - d(t, L)
+        if (to_v[i] != UNKNOWN && to_t[i] != UNKNOWN && to_v[i] > to_t[i]) {
+            bound = std::max<Distance>(bound, to_v[i] - to_t[i]);
+        }
+    }
+    return bound;
+}
+
+void Landmarks::save(const std::string& path) const {
+    std::ofstream out(path, std::ios::binary);
+    if (!out) throw std::runtime_error("Landmarks: não foi possível criar " + path);
+
+    std::uint64_t header[2] = {vertices, landmarks.size()};
+    out.write(LANDMARKS_MAGIC, sizeof(LANDMARKS_MAGIC));
+    out.write(reinterpret_cast<const char*>(header), sizeof(header));
+    out.write(reinterpret_cast<const char*>(landmarks.data()), landmarks.size() * sizeof(Vertex));
+    out.write(reinterpret_cast<const char*>(from_landmark.data()), from_landmark.size() * sizeof(std::uint32_t));
+    out.write(reinterpret_cast<const char*>(to_landmark.data()), to_landmark.size() * sizeof(std::uint32_t));
+    if (!out) throw std::runtime_error("Landmarks: falha ao gravar " + path);
+}
+
+Landmarks Landmarks::load(const std::string& path) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) throw std::runtime_error("Landmarks: não foi possível abrir " + path);
+
+    char magic[sizeof(LANDMARKS_MAGIC)];
+    std::uint64_t header[2];
+    in.read(magic, sizeof(magic));
+    in.read(reinterpret_cast<char*>(header), sizeof(header));
+    if (!in || std::memcmp(magic, LANDMARKS_MAGIC, sizeof(magic)) != 0) {
+        throw std::runtime_error("Landmarks: arquivo inválido " + path);
+    }
+
+    // O cabeçalho vem do arquivo: n e k são validados contra o tamanho
+    // dele antes de qualquer alocação. Os marcos são vértices distintos,
+    // então k <= n, e n * k <= bytes / 8 exclui o estouro da conta
+    const std::uint64_t n = header[0], k = header[1];
+    const std::uint64_t header_bytes = sizeof(LANDMARKS_MAGIC) + sizeof(header);
+    in.seekg(0, std::ios::end);
+    const std::uint64_t file_bytes = static_cast<std::uint64_t>(in.tellg());
+    in.seekg(static_cast<std::streamoff>(header_bytes));
+    bool valid = n < NO_VERTEX && k <= n && (k == 0 || n <= file_bytes / 8 / k);
+    if (valid) {
+        valid = header_bytes + k * sizeof(Vertex) + 2 * n * k * sizeof(std::uint32_t) == file_bytes;
+    }
+    if (!in || !valid) throw std::runtime_error("Landmarks: cabeçalho inconsistente com o tamanho de " + path);
+
+    Landmarks result;
+    result.vertices = static_cast<Vertex>(n);
+    std::size_t table_size = static_cast<std::size_t>(n * k);
+    result.landmarks.resize(header[1]);
+    result.from_landmark.resize(table_size);
+    result.to_landmark.resize(table_size);
+    in.read(reinterpret_cast<char*>(result.landmarks.data()), header[1] * sizeof(Vertex));
+    in.read(reinterpret_cast<char*>(result.from_landmark.data()), table_size * sizeof(std::uint32_t));
+    in.read(reinterpret_cast<char*>(result.to_landmark.data()), table_size * sizeof(std::uint32_t));
+    if (!in) throw std::runtime_error("Landmarks: arquivo truncado " + path);
+    for (Vertex landmark : result.landmarks) {
+        if (landmark >= n) throw std::runtime_error("Landmarks: marco fora do grafo em " + path);
+    }
+    return result;
+}
+
+ALTQuery::ALTQuery(const CSRGraph& graph, const Landmarks& landmarks)
+    : graph(&graph), landmarks(&landmarks),
+      dist(graph.num_vertices()), potential(graph.num_vertices()), pred(graph.num_vertices()),
+      stamp(graph.num_vertices(), 0), generation(0), last_target(NO_VERTEX), settled(0) {
+    if (landmarks.num_vertices() != graph.num_vertices()) {
+        throw std::invalid_argument("ALTQuery: marcos calculados para outro grafo");
+    }
+    queue.prepare(graph);
+}
+
+Distance ALTQuery::run(Vertex source, Vertex target) {
+    if (++generation == 0) {
+        std::fill(stamp.begin(), stamp.end(), 0);
+        generation = 1;
+    }
+    queue.clear();
+    settled = 0;
+    last_target = target;
+
+    stamp[source] = generation;
+    dist[source] = 0;
+    potential[source] = landmarks->lower_bound(source, target);
+    pred[source] = NO_VERTEX;
+    queue.push(source, potential[source]);
+
+    while (!queue.empty()) {
+        std::pair<Distance, Vertex> top = queue.pop();
+        Vertex u = top.second;
+
+        // A chave é dist + potencial; entrada obsoleta se maior que a atual
+        if (top.first > dist[u] + potential[u]) continue;
+        ++settled;
+        if (u == target) return dist[u];
+
+        for (std::uint64_t e = graph->edge_begin(u); e < graph->edge_end(u); ++e) {
+            Vertex v = graph->target(e);
+            Distance nd = dist[u] + graph->weight(e);
+
+            if (stamp[v] != generation) {
+                stamp[v] = generation;
+                potential[v] = landmarks->lower_bound(v, target);
+            } else if (nd >= dist[v]) {
+                continue;
+            }
+            dist[v] = nd;
+            pred[v] = u;
+            queue.push(v, nd + potential[v]);
+        }
+    }
+    return INF_DISTANCE;
+}
+
+std::vector<Vertex> ALTQuery::path() const {
+    std::vector<Vertex> result;
+    if (last_target == NO_VERTEX || stamp[last_target] != generation) return result;
+
+    for (Vertex cur = last_target; cur != NO_VERTEX; cur = pred[cur]) {
+        result.push_back(cur);
+    }
+    std::reverse(result.begin(), result.end());
+    return result;
+}
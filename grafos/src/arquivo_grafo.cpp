@@ -0,0 +1,354 @@
+#include "arquivo_grafo.h"
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+
+const char GRAPH_MAGIC[8] = {'C', 'S', 'R', 'G', 'R', 'A', 'F', '1'};
+const std::size_t READ_BUFFER_SIZE = 16 << 20;
+
+struct BinaryHeader {
+    char magic[8];
+    std::uint64_t num_vertices;
+    std::uint64_t num_edges;
+    std::uint64_t reserved;
+};
+
+struct BinaryLayout {
+    std::uint64_t offsets_pos;
+    std::uint64_t targets_pos;
+    std::uint64_t weights_pos;
+    std::uint64_t total_size;
+};
+
+// Tamanhos que não cabem em 64 bits (cabeçalho corrompido) são rejeitados
+// antes de qualquer conta: nada de layout que dá a volta e parece válido
+BinaryLayout layout_for(std::uint64_t n, std::uint64_t m) {
+    const std::uint64_t limit = std::numeric_limits<std::uint64_t>::max() / 4;
+    if (n >= limit / sizeof(std::uint64_t) || m >= limit / (sizeof(Vertex) + sizeof(Weight))) {
+        throw std::runtime_error("Grafo grande demais para o formato binário");
+    }
+    BinaryLayout layout;
+    layout.offsets_pos = sizeof(BinaryHeader);
+    layout.targets_pos = layout.offsets_pos + (n + 1) * sizeof(std::uint64_t);
+    layout.weights_pos = layout.targets_pos + (m * sizeof(Vertex) + 7) / 8 * 8;
+    layout.total_size = layout.weights_pos + m * sizeof(Weight);
+    return layout;
+}
+
+// Leitor de linhas com buffer grande e fread (sem iostreams)
+class TextScanner {
+public:
+    explicit TextScanner(const std::string& path)
+        : file(std::fopen(path.c_str(), "rb")), buffer(READ_BUFFER_SIZE),
+          pos(0), filled(0), eof(false), line(0) {
+        if (file == nullptr) throw std::runtime_error("Não foi possível abrir " + path);
+    }
+
+    ~TextScanner() { std::fclose(file); }
+
+    TextScanner(const TextScanner&) = delete;
+    TextScanner& operator=(const TextScanner&) = delete;
+
+    bool next_line(const char*& begin, const char*& end) {
+        while (true) {
+            const char* start = buffer.data() + pos;
+            const char* newline = static_cast<const char*>(std::memchr(start, '\n', filled - pos));
+            if (newline != nullptr) {
+                begin = start;
+                end = newline;
+                pos = newline - buffer.data() + 1;
+                ++line;
+                return true;
+            }
+            if (eof) {
+                if (pos == filled) return false;
+                begin = start;
+                end = buffer.data() + filled;
+                pos = filled;
+                ++line;
+                return true;
+            }
+
+            // Move o pedaço de linha incompleto para o início e lê mais
+            std::size_t rest = filled - pos;
+            std::memmove(buffer.data(), buffer.data() + pos, rest);
+            pos = 0;
+            filled = rest;
+            if (filled == buffer.size()) throw std::runtime_error("Linha longa demais no arquivo de grafo");
+
+            std::size_t got = std::fread(buffer.data() + filled, 1, buffer.size() - filled, file);
+            if (got == 0) {
+                if (std::ferror(file)) throw std::runtime_error("Erro de leitura no arquivo de grafo");
+                eof = true;
+            }
+            filled += got;
+        }
+    }
+
+    std::uint64_t line_number() const { return line; }
+
+private:
+    std::FILE* file;
+    std::vector<char> buffer;
+    std::size_t pos;
+    std::size_t filled;
+    bool eof;
+    std::uint64_t line;
+};
+
+void skip_spaces(const char*& p, const char* end) {
+    while (p < end && (*p == ' ' || *p == '\t' || *p == '\r')) ++p;
+}
+
+// Campo numérico: só dígitos, seguidos de espaço ou do fim da linha.
+// "-5", "7x", "1e3" e valores acima de 2^64 - 1 falham
+bool parse_number(const char*& p, const char* end, std::uint64_t& value) {
+    skip_spaces(p, end);
+    if (p == end || *p < '0' || *p > '9') return false;
+    value = 0;
+    while (p < end && *p >= '0' && *p <= '9') {
+        std::uint64_t d = static_cast<std::uint64_t>(*p - '0');
+        if (value > (std::numeric_limits<std::uint64_t>::max() - d) / 10) return false;
+        value = value * 10 + d;
+        ++p;
+    }
+    return p == end || *p == ' ' || *p == '\t' || *p == '\r';
+}
+
+// Depois do último campo só pode haver espaços
+bool at_line_end(const char*& p, const char* end) {
+    skip_spaces(p, end);
+    return p == end;
+}
+
+[[noreturn]] void parse_error(const TextScanner& scanner, const std::string& message) {
+    throw std::runtime_error("Linha " + std::to_string(scanner.line_number()) + ": " + message);
+}
+
+// Chama callback(u, v, w) para cada aresta, com vértices a partir de 0.
+// declared_vertices recebe o n do cabeçalho DIMACS (0 em listas de arestas).
+template <typename Callback>
+void scan_edges(const std::string& path, TextGraphFormat format,
+                std::uint64_t& declared_vertices, Callback callback) {
+    TextScanner scanner(path);
+    const char* begin;
+    const char* end;
+    declared_vertices = 0;
+    bool has_header = false;
+
+    while (scanner.next_line(begin, end)) {
+        const char* p = begin;
+        skip_spaces(p, end);
+        if (p == end) continue;
+
+        std::uint64_t u, v, w = 1;
+        if (format == TextGraphFormat::Dimacs) {
+            char kind = *p++;
+            if (kind == 'c') continue;
+            if (kind == 'p') {
+                skip_spaces(p, end);
+                while (p < end && *p != ' ' && *p != '\t') ++p;  // "sp"
+                std::uint64_t m;
+                if (!parse_number(p, end, declared_vertices) || !parse_number(p, end, m) || !at_line_end(p, end)) {
+                    parse_error(scanner, "cabeçalho 'p' inválido");
+                }
+                has_header = true;
+                continue;
+            }
+            if (kind != 'a') parse_error(scanner, "linha DIMACS desconhecida");
+            if (!has_header) parse_error(scanner, "aresta antes do cabeçalho 'p'");
+            if (!parse_number(p, end, u) || !parse_number(p, end, v) || !parse_number(p, end, w) ||
+                !at_line_end(p, end)) {
+                parse_error(scanner, "aresta 'a' inválida");
+            }
+            if (u == 0 || v == 0 || u > declared_vertices || v > declared_vertices) {
+                parse_error(scanner, "vértice fora de 1..n");
+            }
+            --u;
+            --v;
+        } else {
+            if (*p == '#' || *p == '%') continue;
+            if (!parse_number(p, end, u) || !parse_number(p, end, v)) {
+                parse_error(scanner, "esperado 'u v [w]'");
+            }
+            if (!at_line_end(p, end) && (!parse_number(p, end, w) || !at_line_end(p, end))) {
+                parse_error(scanner, "peso inválido em 'u v [w]'");
+            }
+        }
+        if (u >= NO_VERTEX || v >= NO_VERTEX) parse_error(scanner, "vértice não cabe em 32 bits");
+        if (w > std::numeric_limits<Weight>::max()) parse_error(scanner, "peso não cabe em 32 bits");
+        callback(static_cast<Vertex>(u), static_cast<Vertex>(v), static_cast<Weight>(w));
+    }
+}
+
+}
+
+void convert_text_graph(const std::string& text_path, TextGraphFormat format,
+                        const std::string& binary_path) {
+    // Passada 1: graus de saída
+    std::vector<std::uint64_t> cursor;
+    std::uint64_t declared = 0;
+    scan_edges(text_path, format, declared, [&](Vertex u, Vertex v, Weight) {
+        std::size_t needed = static_cast<std::size_t>(std::max(u, v)) + 1;
+        if (cursor.size() < needed) cursor.resize(needed, 0);
+        ++cursor[u];
+    });
+    if (cursor.size() < declared) cursor.resize(declared, 0);
+
+    const std::uint64_t n = cursor.size();
+    std::uint64_t m = 0;
+    for (std::uint64_t& degree : cursor) {
+        std::uint64_t start = m;
+        m += degree;
+        degree = start;  // vira a posição de escrita de cada vértice
+    }
+    BinaryLayout layout = layout_for(n, m);
+
+    // Monta num arquivo temporário e só renomeia no fim: uma falha em
+    // qualquer ponto não deixa em binary_path um grafo que parece completo
+    const std::string temp_path = binary_path + ".tmp";
+    int fd = ::open(temp_path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) throw std::runtime_error("Não foi possível criar " + temp_path);
+    if (::ftruncate(fd, static_cast<off_t>(layout.total_size)) != 0) {
+        ::close(fd);
+        ::unlink(temp_path.c_str());
+        throw std::runtime_error("Não foi possível dimensionar " + temp_path);
+    }
+    void* mapped = ::mmap(nullptr, layout.total_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (mapped == MAP_FAILED) {
+        ::unlink(temp_path.c_str());
+        throw std::runtime_error("mmap falhou em " + temp_path);
+    }
+
+    char* base = static_cast<char*>(mapped);
+    BinaryHeader header;
+    std::memcpy(header.magic, GRAPH_MAGIC, sizeof(GRAPH_MAGIC));
+    header.num_vertices = n;
+    header.num_edges = m;
+    header.reserved = 0;
+    std::memcpy(base, &header, sizeof(header));
+
+    std::uint64_t* offsets = reinterpret_cast<std::uint64_t*>(base + layout.offsets_pos);
+    std::memcpy(offsets, cursor.data(), n * sizeof(std::uint64_t));
+    offsets[n] = m;
+
+    // Passada 2: cada aresta vai direto para a posição final no arquivo
+    Vertex* targets = reinterpret_cast<Vertex*>(base + layout.targets_pos);
+    Weight* weights = reinterpret_cast<Weight*>(base + layout.weights_pos);
+    std::uint64_t written = 0;
+    try {
+        scan_edges(text_path, format, declared, [&](Vertex u, Vertex v, Weight w) {
+            if (u >= n || cursor[u] >= offsets[u + 1]) {
+                throw std::runtime_error("Arquivo mudou entre as passadas: " + text_path);
+            }
+            std::uint64_t pos = cursor[u]++;
+            targets[pos] = v;
+            weights[pos] = w;
+            ++written;
+        });
+    } catch (...) {
+        ::munmap(mapped, layout.total_size);
+        ::unlink(temp_path.c_str());
+        throw;
+    }
+    ::munmap(mapped, layout.total_size);
+    if (written != m) {
+        ::unlink(temp_path.c_str());
+        throw std::runtime_error("Arquivo mudou entre as passadas: " + text_path);
+    }
+    if (::rename(temp_path.c_str(), binary_path.c_str()) != 0) {
+        ::unlink(temp_path.c_str());
+        throw std::runtime_error("Não foi possível criar " + binary_path);
+    }
+}
+
+void save_binary_graph(const CSRGraph& graph, const std::string& binary_path) {
+    std::ofstream out(binary_path, std::ios::binary);
+    if (!out) throw std::runtime_error("Não foi possível criar " + binary_path);
+
+    const std::uint64_t n = graph.num_vertices();
+    const std::uint64_t m = graph.num_edges();
+    BinaryLayout layout = layout_for(n, m);
+    BinaryHeader header;
+    std::memcpy(header.magic, GRAPH_MAGIC, sizeof(GRAPH_MAGIC));
+    header.num_vertices = n;
+    header.num_edges = m;
+    header.reserved = 0;
+
+    std::uint64_t empty_offsets = 0;
+    const char padding[8] = {0};
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    if (graph.offsets_data() == nullptr) {
+        out.write(reinterpret_cast<const char*>(&empty_offsets), sizeof(empty_offsets));
+    } else {
+        out.write(reinterpret_cast<const char*>(graph.offsets_data()), (n + 1) * sizeof(std::uint64_t));
+    }
+    out.write(reinterpret_cast<const char*>(graph.targets_data()), m * sizeof(Vertex));
+    out.write(padding, layout.weights_pos - layout.targets_pos - m * sizeof(Vertex));
+    out.write(reinterpret_cast<const char*>(graph.weights_data()), m * sizeof(Weight));
+    if (!out) throw std::runtime_error("Falha ao gravar " + binary_path);
+}
+
+CSRGraph map_binary_graph(const std::string& binary_path, bool verify) {
+    int fd = ::open(binary_path.c_str(), O_RDONLY);
+    if (fd < 0) throw std::runtime_error("Não foi possível abrir " + binary_path);
+
+    struct stat info;
+    if (::fstat(fd, &info) != 0 || static_cast<std::uint64_t>(info.st_size) < sizeof(BinaryHeader)) {
+        ::close(fd);
+        throw std::runtime_error("Arquivo de grafo inválido: " + binary_path);
+    }
+    std::size_t size = static_cast<std::size_t>(info.st_size);
+    void* mapped = ::mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (mapped == MAP_FAILED) throw std::runtime_error("mmap falhou em " + binary_path);
+
+    std::shared_ptr<const void> owner(mapped, [size](const void* p) {
+        ::munmap(const_cast<void*>(p), size);
+    });
+
+    const char* base = static_cast<const char*>(mapped);
+    BinaryHeader header;
+    std::memcpy(&header, base, sizeof(header));
+    if (std::memcmp(header.magic, GRAPH_MAGIC, sizeof(GRAPH_MAGIC)) != 0 ||
+        header.num_vertices >= NO_VERTEX) {
+        throw std::runtime_error("Arquivo de grafo inválido: " + binary_path);
+    }
+    BinaryLayout layout;
+    try {
+        layout = layout_for(header.num_vertices, header.num_edges);
+    } catch (const std::runtime_error&) {
+        throw std::runtime_error("Arquivo de grafo inválido: " + binary_path);
+    }
+    if (layout.total_size != size) {
+        throw std::runtime_error("Arquivo de grafo truncado ou corrompido: " + binary_path);
+    }
+    const std::uint64_t n = header.num_vertices;
+    const std::uint64_t m = header.num_edges;
+    const std::uint64_t* offsets = reinterpret_cast<const std::uint64_t*>(base + layout.offsets_pos);
+    const Vertex* targets = reinterpret_cast<const Vertex*>(base + layout.targets_pos);
+    if (offsets[n] != m) {
+        throw std::runtime_error("Arquivo de grafo truncado ou corrompido: " + binary_path);
+    }
+    if (verify) {
+        // Offsets crescentes de 0 a m e destinos em 0..n-1: as consultas
+        // indexam por eles sem conferir
+        bool valid = offsets[0] == 0;
+        for (std::uint64_t u = 0; u < n && valid; ++u) valid = offsets[u] <= offsets[u + 1];
+        for (std::uint64_t e = 0; e < m && valid; ++e) valid = targets[e] < n;
+        if (!valid) throw std::runtime_error("Arquivo de grafo corrompido: " + binary_path);
+    }
+
+    return CSRGraph::view(static_cast<Vertex>(n), m, offsets, targets,
+                          reinterpret_cast<const Weight*>(base + layout.weights_pos), owner);
+}
@@ -0,0 +1,393 @@
+#include "contraction_hierarchy.h"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <queue>
+#include <stdexcept>
+
+namespace {
+
+const char CH_MAGIC[8] = {'C', 'H', 'I', 'N', 'D', 'E', 'X', '1'};
+
+// Limites de vértices fixados por busca de testemunha: se estourar,
+// o atalho é criado por precaução (nunca deixa a hierarquia incorreta).
+// A simulação usada só para calcular prioridades pode ser mais grosseira.
+const int WITNESS_SETTLE_LIMIT = 1000;
+const int SIMULATION_SETTLE_LIMIT = 100;
+
+struct Arc {
+    Vertex to;
+    Distance weight;
+};
+
+class Contractor {
+public:
+    explicit Contractor(const CSRGraph& graph);
+
+    void run(std::vector<Vertex>& ranks, std::vector<Edge>& up_edges,
+             std::vector<Edge>& down_edges, std::uint64_t& shortcuts);
+
+private:
+    Vertex n;
+    std::vector<std::vector<Arc>> out;
+    std::vector<std::vector<Arc>> in;
+    std::vector<bool> contracted;
+    std::vector<int> deleted_neighbors;
+
+    std::vector<Distance> witness_dist;
+    std::vector<std::uint32_t> witness_stamp;
+    std::uint32_t witness_generation;
+    BinaryHeapQueue witness_queue;
+
+    static void add_arc(std::vector<Arc>& arcs, Vertex to, Distance weight);
+    static void remove_arc(std::vector<Arc>& arcs, Vertex to);
+
+    void witness_search(Vertex source, Vertex skip, Distance limit, int settle_limit);
+    Distance witness_distance(Vertex v) const;
+    int process_shortcuts(Vertex v, bool add);
+    long long priority(Vertex v);
+    void contract(Vertex v, std::vector<Edge>& up_edges, std::vector<Edge>& down_edges);
+};
+
+Contractor::Contractor(const CSRGraph& graph)
+    : n(graph.num_vertices()), out(n), in(n), contracted(n, false), deleted_neighbors(n, 0),
+      witness_dist(n), witness_stamp(n, 0), witness_generation(0) {
+    for (Vertex u = 0; u < n; ++u) {
+        for (std::uint64_t e = graph.edge_begin(u); e < graph.edge_end(u); ++e) {
+            Vertex v = graph.target(e);
+            if (u == v) continue;  // laços nunca fazem parte de caminhos mínimos
+            add_arc(out[u], v, graph.weight(e));
+            add_arc(in[v], u, graph.weight(e));
+        }
+    }
+}
+
+// Insere ou encurta a aresta (arestas paralelas ficam só com o menor peso)
+void Contractor::add_arc(std::vector<Arc>& arcs, Vertex to, Distance weight) {
+    for (Arc& arc : arcs) {
+        if (arc.to == to) {
+            arc.weight = std::min(arc.weight, weight);
+            return;
+        }
+    }
+    arcs.push_back({to, weight});
+}
+
+void Contractor::remove_arc(std::vector<Arc>& arcs, Vertex to) {
+    for (std::size_t i = 0; i < arcs.size(); ++i) {
+        if (arcs[i].to == to) {
+            arcs[i] = arcs.back();
+            arcs.pop_back();
+            return;
+        }
+    }
+}
+
+void Contractor::witness_search(Vertex source, Vertex skip, Distance limit, int settle_limit) {
+    if (++witness_generation == 0) {
+        std::fill(witness_stamp.begin(), witness_stamp.end(), 0);
+        witness_generation = 1;
+    }
+    witness_queue.clear();
+    witness_stamp[source] = witness_generation;
+    witness_dist[source] = 0;
+    witness_queue.push(source, 0);
+
+    int settled = 0;
+    while (!witness_queue.empty() && settled < settle_limit) {
+        std::pair<Distance, Vertex> top = witness_queue.pop();
+        Vertex u = top.second;
+        if (top.first > witness_dist[u]) continue;
+        if (top.first > limit) break;
+        ++settled;
+
+        for (const Arc& arc : out[u]) {
+            if (arc.to == skip) continue;
+            Distance nd = top.first + arc.weight;
+            if (witness_stamp[arc.to] != witness_generation || nd < witness_dist[arc.to]) {
+                witness_stamp[arc.to] = witness_generation;
+                witness_dist[arc.to] = nd;
+                witness_queue.push(arc.to, nd);
+            }
+        }
+    }
+}
+
+Distance Contractor::witness_distance(Vertex v) const {
+    return witness_stamp[v] == witness_generation ? witness_dist[v] : INF_DISTANCE;
+}
+
+// Conta (e, se add, insere) os atalhos necessários para contrair v
+int Contractor::process_shortcuts(Vertex v, bool add) {
+    int count = 0;
+    for (const Arc& in_arc : in[v]) {
+        Vertex u = in_arc.to;
+
+        Distance limit = 0;
+        bool has_target = false;
+        for (const Arc& out_arc : out[v]) {
+            if (out_arc.to == u) continue;
+            limit = std::max(limit, in_arc.weight + out_arc.weight);
+            has_target = true;
+        }
+        if (!has_target) continue;
+
+        witness_search(u, v, limit, add ? WITNESS_SETTLE_LIMIT : SIMULATION_SETTLE_LIMIT);
+        for (const Arc& out_arc : out[v]) {
+            Vertex x = out_arc.to;
+            Distance via = in_arc.weight + out_arc.weight;
+            if (x == u || witness_distance(x) <= via) continue;
+
+            ++count;
+            if (add) {
+                if (via > std::numeric_limits<Weight>::max()) {
+                    throw std::overflow_error("ContractionHierarchy: atalho excede peso de 32 bits");
+                }
+                add_arc(out[u], x, via);
+                add_arc(in[x], u, via);
+            }
+        }
+    }
+    return count;
+}
+
+long long Contractor::priority(Vertex v) {
+    long long removed = static_cast<long long>(in[v].size() + out[v].size());
+    long long edge_difference = process_shortcuts(v, false) - removed;
+    return edge_difference + deleted_neighbors[v];
+}
+
+void Contractor::contract(Vertex v, std::vector<Edge>& up_edges, std::vector<Edge>& down_edges) {
+    // As listas de v só contêm vértices ainda não contraídos: todos
+    // terão rank maior que v.
+    for (const Arc& arc : out[v]) up_edges.push_back({v, arc.to, static_cast<Weight>(arc.weight)});
+    for (const Arc& arc : in[v]) down_edges.push_back({v, arc.to, static_cast<Weight>(arc.weight)});
+
+    process_shortcuts(v, true);
+    contracted[v] = true;
+
+    for (const Arc& arc : out[v]) remove_arc(in[arc.to], v);
+    for (const Arc& arc : in[v]) remove_arc(out[arc.to], v);
+}
+
+void Contractor::run(std::vector<Vertex>& ranks, std::vector<Edge>& up_edges,
+                     std::vector<Edge>& down_edges, std::uint64_t& shortcuts) {
+    typedef std::pair<long long, Vertex> entry;
+    std::priority_queue<entry, std::vector<entry>, std::greater<entry>> pq;
+    std::vector<long long> current_priority(n);
+    for (Vertex v = 0; v < n; ++v) {
+        current_priority[v] = priority(v);
+        pq.push({current_priority[v], v});
+    }
+
+    std::uint64_t original_edges = 0;
+    for (Vertex v = 0; v < n; ++v) original_edges += out[v].size();
+
+    ranks.assign(n, 0);
+    Vertex next_rank = 0;
+    std::vector<Vertex> neighbors;
+    while (!pq.empty()) {
+        entry top = pq.top();
+        pq.pop();
+        Vertex v = top.second;
+        if (contracted[v] || top.first != current_priority[v]) continue;
+
+        // Atualização preguiçosa: se a prioridade piorou além do próximo
+        // da fila, devolve v e tenta outro.
+        long long updated = priority(v);
+        if (updated > top.first && !pq.empty() && updated > pq.top().first) {
+            current_priority[v] = updated;
+            pq.push({updated, v});
+            continue;
+        }
+
+        neighbors.clear();
+        for (const Arc& arc : out[v]) neighbors.push_back(arc.to);
+        for (const Arc& arc : in[v]) neighbors.push_back(arc.to);
+
+        contract(v, up_edges, down_edges);
+        ranks[v] = next_rank++;
+
+        std::sort(neighbors.begin(), neighbors.end());
+        neighbors.erase(std::unique(neighbors.begin(), neighbors.end()), neighbors.end());
+        for (Vertex w : neighbors) {
+            ++deleted_neighbors[w];
+            current_priority[w] = priority(w);
+            pq.push({current_priority[w], w});
+        }
+    }
+
+    shortcuts = up_edges.size() + down_edges.size() - original_edges;
+}
+
+}
+
+ContractionHierarchy ContractionHierarchy::build(const CSRGraph& graph) {
+    ContractionHierarchy ch;
+    std::vector<Edge> up_edges, down_edges;
+    Contractor(graph).run(ch.ranks, up_edges, down_edges, ch.shortcuts);
+    ch.up = CSRGraph(graph.num_vertices(), up_edges);
+    ch.down = CSRGraph(graph.num_vertices(), down_edges);
+    return ch;
+}
+
+void ContractionHierarchy::save(const std::string& path) const {
+    std::ofstream out(path, std::ios::binary);
+    if (!out) throw std::runtime_error("ContractionHierarchy: não foi possível criar " + path);
+
+    std::uint64_t header[2] = {ranks.size(), shortcuts};
+    out.write(CH_MAGIC, sizeof(CH_MAGIC));
+    out.write(reinterpret_cast<const char*>(header), sizeof(header));
+    out.write(reinterpret_cast<const char*>(ranks.data()), ranks.size() * sizeof(Vertex));
+    up.write(out);
+    down.write(out);
+    if (!out) throw std::runtime_error("ContractionHierarchy: falha ao gravar " + path);
+}
+
+ContractionHierarchy ContractionHierarchy::load(const std::string& path) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) throw std::runtime_error("ContractionHierarchy: não foi possível abrir " + path);
+
+    char magic[sizeof(CH_MAGIC)];
+    std::uint64_t header[2];
+    in.read(magic, sizeof(magic));
+    in.read(reinterpret_cast<char*>(header), sizeof(header));
+    if (!in || std::memcmp(magic, CH_MAGIC, sizeof(magic)) != 0) {
+        throw std::runtime_error("ContractionHierarchy: arquivo inválido " + path);
+    }
+
+    ContractionHierarchy ch;
+    ch.shortcuts = header[1];
+    ch.ranks.resize(header[0]);
+    in.read(reinterpret_cast<char*>(ch.ranks.data()), ch.ranks.size() * sizeof(Vertex));
+    ch.up = CSRGraph::read(in);
+    ch.down = CSRGraph::read(in);
+    if (ch.up.num_vertices() != header[0] || ch.down.num_vertices() != header[0]) {
+        throw std::runtime_error("ContractionHierarchy: arquivo inconsistente " + path);
+    }
+    return ch;
+}
+
+CHSearch::CHSearch(const CSRGraph& graph, const CSRGraph& stall_graph)
+    : graph(&graph), stall_graph(&stall_graph), dist(graph.num_vertices()),
+      stamp(graph.num_vertices(), 0), generation(0) {
+    queue.prepare(graph);
+}
+
+void CHSearch::start(Vertex source) {
+    if (++generation == 0) {
+        std::fill(stamp.begin(), stamp.end(), 0);
+        generation = 1;
+    }
+    queue.clear();
+    settled.clear();
+    stamp[source] = generation;
+    dist[source] = 0;
+    queue.push(source, 0);
+}
+
+Vertex CHSearch::settle_next() {
+    std::pair<Distance, Vertex> top = queue.pop();
+    Distance d = top.first;
+    Vertex u = top.second;
+    if (d > dist[u]) return NO_VERTEX;
+
+    // Stall-on-demand: vizinho de rank maior chega a u por menos
+    for (std::uint64_t e = stall_graph->edge_begin(u); e < stall_graph->edge_end(u); ++e) {
+        Vertex w = stall_graph->target(e);
+        if (reached(w) && dist[w] + stall_graph->weight(e) < d) return NO_VERTEX;
+    }
+
+    settled.push_back(u);
+    for (std::uint64_t e = graph->edge_begin(u); e < graph->edge_end(u); ++e) {
+        Vertex v = graph->target(e);
+        Distance nd = d + graph->weight(e);
+        if (!reached(v) || nd < dist[v]) {
+            stamp[v] = generation;
+            dist[v] = nd;
+            queue.push(v, nd);
+        }
+    }
+    return u;
+}
+
+void CHSearch::run_to_completion() {
+    while (!queue.empty()) settle_next();
+}
+
+CHQuery::CHQuery(const ContractionHierarchy& ch)
+    : forward(ch.upward(), ch.downward()), backward(ch.downward(), ch.upward()), settled(0) {}
+
+Distance CHQuery::run(Vertex source, Vertex target) {
+    forward.start(source);
+    backward.start(target);
+    settled = 0;
+
+    Distance best = INF_DISTANCE;
+    while (true) {
+        // Cada lado para quando sua menor chave já não melhora o melhor candidato
+        bool forward_active = !forward.empty() && forward.top_key() < best;
+        bool backward_active = !backward.empty() && backward.top_key() < best;
+        if (!forward_active && !backward_active) break;
+
+        bool use_forward = forward_active && (!backward_active || forward.top_key() <= backward.top_key());
+        CHSearch& side = use_forward ? forward : backward;
+        CHSearch& other = use_forward ? backward : forward;
+
+        Vertex u = side.settle_next();
+        if (u == NO_VERTEX) continue;
+        ++settled;
+        if (other.reached(u)) best = std::min(best, side.distance(u) + other.distance(u));
+    }
+    return best;
+}
+
+CHManyToMany::CHManyToMany(const ContractionHierarchy& ch)
+    : forward(ch.upward(), ch.downward()), backward(ch.downward(), ch.upward()),
+      bucket_begin(ch.num_vertices()), bucket_end(ch.num_vertices()),
+      bucket_stamp(ch.num_vertices(), 0), generation(0) {}
+
+void CHManyToMany::run(const std::vector<Vertex>& sources, const std::vector<Vertex>& targets,
+                       std::vector<Distance>& table) {
+    if (++generation == 0) {
+        std::fill(bucket_stamp.begin(), bucket_stamp.end(), 0);
+        generation = 1;
+    }
+
+    // Fase 1: buscas reversas preenchem os baldes
+    entries.clear();
+    for (std::uint32_t j = 0; j < targets.size(); ++j) {
+        backward.start(targets[j]);
+        backward.run_to_completion();
+        for (Vertex v : backward.settled_vertices()) {
+            entries.push_back({v, j, backward.distance(v)});
+        }
+    }
+    std::sort(entries.begin(), entries.end(),
+              [](const BucketEntry& a, const BucketEntry& b) { return a.vertex < b.vertex; });
+    for (std::uint64_t i = 0; i < entries.size(); ++i) {
+        Vertex v = entries[i].vertex;
+        if (bucket_stamp[v] != generation) {
+            bucket_stamp[v] = generation;
+            bucket_begin[v] = i;
+        }
+        bucket_end[v] = i + 1;
+    }
+
+    // Fase 2: buscas diretas varrem os baldes dos vértices que fixam
+    const std::size_t num_targets = targets.size();
+    table.assign(sources.size() * num_targets, INF_DISTANCE);
+    for (std::size_t i = 0; i < sources.size(); ++i) {
+        forward.start(sources[i]);
+        forward.run_to_completion();
+        Distance* row = &table[i * num_targets];
+        for (Vertex v : forward.settled_vertices()) {
+            if (bucket_stamp[v] != generation) continue;
+            Distance d = forward.distance(v);
+            for (std::uint64_t k = bucket_begin[v]; k < bucket_end[v]; ++k) {
+                row[entries[k].target_index] = std::min(row[entries[k].target_index], d + entries[k].distance);
+            }
+        }
+    }
+}
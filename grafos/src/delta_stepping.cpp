@@ -0,0 +1,170 @@
+#include "delta_stepping.h"
+#include <algorithm>
+#include <thread>
+
+void DeltaStepping::SpinBarrier::reset(unsigned n) {
+    count = n;
+    waiting.store(0, std::memory_order_relaxed);
+}
+
+void DeltaStepping::SpinBarrier::wait() {
+    unsigned gen = generation.load(std::memory_order_acquire);
+    if (waiting.fetch_add(1, std::memory_order_acq_rel) + 1 == count) {
+        waiting.store(0, std::memory_order_relaxed);
+        generation.fetch_add(1, std::memory_order_release);
+        return;
+    }
+    while (generation.load(std::memory_order_acquire) == gen) {
+        std::this_thread::yield();
+    }
+}
+
+DeltaStepping::DeltaStepping(const CSRGraph& graph, unsigned num_threads, Weight delta)
+    : graph(&graph), num_threads(1), delta(1), num_buckets(0),
+      light_end(graph.num_vertices()), targets(graph.num_edges()), weights(graph.num_edges()),
+      dist(graph.num_vertices()), heavy_stamp(graph.num_vertices()), phases(0) {
+    set_num_threads(num_threads);
+    set_delta(delta);
+}
+
+void DeltaStepping::set_num_threads(unsigned n) {
+    if (n == 0) n = std::max(1u, std::thread::hardware_concurrency());
+    num_threads = n;
+    states = std::vector<ThreadState>(n);
+    num_buckets = 0;  // força realocação dos baldes na próxima execução
+}
+
+void DeltaStepping::set_delta(Weight d) {
+    if (d == 0) {
+        // Heurística: peso máximo / grau médio (pelo menos 1)
+        std::uint64_t n = std::max<std::uint64_t>(1, graph->num_vertices());
+        std::uint64_t avg_degree = std::max<std::uint64_t>(1, graph->num_edges() / n);
+        d = static_cast<Weight>(std::max<std::uint64_t>(1, graph->max_weight() / avg_degree));
+    }
+    delta = d;
+    num_buckets = 0;
+    split_edges();
+}
+
+void DeltaStepping::split_edges() {
+    for (Vertex u = 0; u < graph->num_vertices(); ++u) {
+        std::uint64_t light = graph->edge_begin(u);
+        std::uint64_t heavy = graph->edge_end(u);
+        for (std::uint64_t e = graph->edge_begin(u); e < graph->edge_end(u); ++e) {
+            std::uint64_t pos = graph->weight(e) <= delta ? light++ : --heavy;
+            targets[pos] = graph->target(e);
+            weights[pos] = graph->weight(e);
+        }
+        light_end[u] = light;
+    }
+}
+
+bool DeltaStepping::relax(Vertex v, Distance nd, ThreadState& state) {
+    Distance old = dist[v].load(std::memory_order_relaxed);
+    while (nd < old) {
+        if (dist[v].compare_exchange_weak(old, nd, std::memory_order_relaxed)) {
+            state.buckets[(nd / delta) % num_buckets].push_back(v);
+            return true;
+        }
+    }
+    return false;
+}
+
+void DeltaStepping::run(Vertex source) {
+    // Toda distância pendente fica em [atual * delta, atual * delta + maxW],
+    // então maxW / delta + 2 baldes circulares bastam.
+    std::uint64_t needed = graph->max_weight() / delta + 2;
+    if (num_buckets != needed) {
+        num_buckets = needed;
+        for (ThreadState& state : states) {
+            state.buckets.assign(num_buckets, {});
+        }
+    }
+    barrier.reset(num_threads);
+    phases = 0;
+
+    std::vector<std::thread> threads;
+    for (unsigned id = 1; id < num_threads; ++id) {
+        threads.emplace_back(&DeltaStepping::worker, this, id, source);
+    }
+    worker(0, source);
+    for (std::thread& thread : threads) thread.join();
+}
+
+void DeltaStepping::worker(unsigned id, Vertex source) {
+    ThreadState& state = states[id];
+    const std::uint64_t none = INF_DISTANCE;
+
+    // Cada thread reinicia a sua fatia dos vetores compartilhados
+    Vertex n = graph->num_vertices();
+    Vertex begin = static_cast<Vertex>(static_cast<std::uint64_t>(n) * id / num_threads);
+    Vertex end = static_cast<Vertex>(static_cast<std::uint64_t>(n) * (id + 1) / num_threads);
+    for (Vertex v = begin; v < end; ++v) {
+        dist[v].store(INF_DISTANCE, std::memory_order_relaxed);
+        heavy_stamp[v].store(0, std::memory_order_relaxed);
+    }
+    for (auto& bucket : state.buckets) bucket.clear();
+    state.settled.clear();
+    barrier.wait();
+
+    if (id == 0) relax(source, 0, state);
+    std::uint64_t current = 0;
+
+    while (true) {
+        // 1. Menor balde não vazio entre todas as threads
+        state.min_bucket = none;
+        for (std::uint64_t k = 0; k < num_buckets; ++k) {
+            if (!state.buckets[(current + k) % num_buckets].empty()) {
+                state.min_bucket = current + k;
+                break;
+            }
+        }
+        barrier.wait();
+        current = none;
+        for (const ThreadState& other : states) current = std::min(current, other.min_bucket);
+        if (current == none) break;
+        if (id == 0) ++phases;
+
+        // 2. Rodadas de arestas leves até o balde atual esvaziar em todas as threads
+        std::vector<Vertex>& bucket = state.buckets[current % num_buckets];
+        while (true) {
+            state.frontier.clear();
+            state.frontier.swap(bucket);
+            state.frontier_size = state.frontier.size();
+            barrier.wait();
+
+            std::uint64_t total = 0;
+            for (const ThreadState& other : states) total += other.frontier_size;
+            if (total == 0) break;
+
+            for (Vertex u : state.frontier) {
+                Distance d = dist[u].load(std::memory_order_relaxed);
+                // Entrada obsoleta: u já caiu para um balde anterior
+                if (d / delta != current) continue;
+                state.settled.push_back(u);
+                for (std::uint64_t e = graph->edge_begin(u); e < light_end[u]; ++e) {
+                    relax(targets[e], d + weights[e], state);
+                }
+            }
+            barrier.wait();
+        }
+
+        // 3. Arestas pesadas dos vértices fixados neste balde (uma vez por vértice)
+        for (Vertex u : state.settled) {
+            if (heavy_stamp[u].exchange(current + 1, std::memory_order_relaxed) == current + 1) continue;
+            Distance d = dist[u].load(std::memory_order_relaxed);
+            for (std::uint64_t e = light_end[u]; e < graph->edge_end(u); ++e) {
+                relax(targets[e], d + weights[e], state);
+            }
+        }
+        state.settled.clear();
+        barrier.wait();
+    }
+}
+
+void DeltaStepping::copy_distances(std::vector<Distance>& out) const {
+    out.resize(dist.size());
+    for (std::size_t v = 0; v < dist.size(); ++v) {
+        out[v] = dist[v].load(std::memory_order_relaxed);
+    }
+}
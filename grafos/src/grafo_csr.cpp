@@ -0,0 +1,116 @@
+#include "grafo_csr.h"
+#include <algorithm>
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+
+CSRGraph::CSRGraph(Vertex num_vertices, const std::vector<Edge>& edge_list) {
+    auto storage = std::make_shared<Storage>();
+    storage->offsets.assign(static_cast<std::size_t>(num_vertices) + 1, 0);
+    storage->targets.resize(edge_list.size());
+    storage->weights.resize(edge_list.size());
+    std::vector<std::uint64_t>& offs = storage->offsets;
+
+    // Contagem do grau de saída de cada vértice
+    for (const Edge& edge : edge_list) {
+        if (edge.from >= num_vertices || edge.to >= num_vertices) {
+            throw std::out_of_range("CSRGraph: aresta com vértice fora do intervalo");
+        }
+        ++offs[edge.from + 1];
+    }
+    for (Vertex u = 0; u < num_vertices; ++u) {
+        offs[u + 1] += offs[u];
+    }
+
+    // Distribuição estável: arestas de u mantêm a ordem de entrada
+    std::vector<std::uint64_t> cursor(offs.begin(), offs.end() - 1);
+    for (const Edge& edge : edge_list) {
+        std::uint64_t pos = cursor[edge.from]++;
+        storage->targets[pos] = edge.to;
+        storage->weights[pos] = edge.weight;
+    }
+    adopt(storage);
+}
+
+void CSRGraph::adopt(std::shared_ptr<Storage> storage) {
+    vertices = static_cast<Vertex>(storage->offsets.size() - 1);
+    edges = storage->targets.size();
+    offsets = storage->offsets.data();
+    targets = storage->targets.data();
+    weights = storage->weights.data();
+    owner = storage;
+}
+
+CSRGraph CSRGraph::view(Vertex num_vertices, std::uint64_t num_edges,
+                        const std::uint64_t* offsets, const Vertex* targets,
+                        const Weight* weights, std::shared_ptr<const void> owner) {
+    CSRGraph graph;
+    graph.vertices = num_vertices;
+    graph.edges = num_edges;
+    graph.offsets = offsets;
+    graph.targets = targets;
+    graph.weights = weights;
+    graph.owner = std::move(owner);
+    return graph;
+}
+
+CSRGraph CSRGraph::from_adjacency(const std::vector<std::vector<std::pair<int, int>>>& adj) {
+    std::vector<Edge> edge_list;
+    for (std::size_t u = 0; u < adj.size(); ++u) {
+        for (const auto& edge : adj[u]) {
+            if (edge.first < 0 || edge.second < 0) {
+                throw std::invalid_argument("CSRGraph: vértice ou peso negativo");
+            }
+            edge_list.push_back({static_cast<Vertex>(u), static_cast<Vertex>(edge.first),
+                                 static_cast<Weight>(edge.second)});
+        }
+    }
+    return CSRGraph(static_cast<Vertex>(adj.size()), edge_list);
+}
+
+Weight CSRGraph::max_weight() const {
+    return edges == 0 ? 0 : *std::max_element(weights, weights + edges);
+}
+
+CSRGraph CSRGraph::reversed() const {
+    std::vector<Edge> edge_list;
+    edge_list.reserve(num_edges());
+    for (Vertex u = 0; u < num_vertices(); ++u) {
+        for (std::uint64_t e = edge_begin(u); e < edge_end(u); ++e) {
+            edge_list.push_back({targets[e], u, weights[e]});
+        }
+    }
+    return CSRGraph(num_vertices(), edge_list);
+}
+
+void CSRGraph::write(std::ostream& out) const {
+    std::uint64_t sizes[2] = {vertices, edges};
+    std::uint64_t empty_offsets = 0;
+    out.write(reinterpret_cast<const char*>(sizes), sizeof(sizes));
+    if (offsets == nullptr) {
+        out.write(reinterpret_cast<const char*>(&empty_offsets), sizeof(empty_offsets));
+    } else {
+        out.write(reinterpret_cast<const char*>(offsets), (vertices + 1ull) * sizeof(std::uint64_t));
+    }
+    out.write(reinterpret_cast<const char*>(targets), edges * sizeof(Vertex));
+    out.write(reinterpret_cast<const char*>(weights), edges * sizeof(Weight));
+}
+
+CSRGraph CSRGraph::read(std::istream& in) {
+    std::uint64_t sizes[2] = {0, 0};
+    in.read(reinterpret_cast<char*>(sizes), sizeof(sizes));
+    if (!in) throw std::runtime_error("CSRGraph: cabeçalho truncado");
+
+    auto storage = std::make_shared<Storage>();
+    storage->offsets.resize(sizes[0] + 1);
+    storage->targets.resize(sizes[1]);
+    storage->weights.resize(sizes[1]);
+    in.read(reinterpret_cast<char*>(storage->offsets.data()), storage->offsets.size() * sizeof(std::uint64_t));
+    in.read(reinterpret_cast<char*>(storage->targets.data()), storage->targets.size() * sizeof(Vertex));
+    in.read(reinterpret_cast<char*>(storage->weights.data()), storage->weights.size() * sizeof(Weight));
+    if (!in || storage->offsets.back() != sizes[1]) throw std::runtime_error("CSRGraph: dados truncados");
+
+    CSRGraph graph;
+    graph.adopt(storage);
+    return graph;
+}
@@ -0,0 +1,95 @@
+#include "ponto_a_ponto.h"
+#include <algorithm>
+
+BidirectionalDijkstra::BidirectionalDijkstra(const CSRGraph& forward, const CSRGraph& reverse)
+    : generation(0), best(INF_DISTANCE), meeting(NO_VERTEX), settled(0) {
+    const CSRGraph* graphs[2] = {&forward, &reverse};
+    for (int side = 0; side < 2; ++side) {
+        sides[side].graph = graphs[side];
+        sides[side].dist.resize(forward.num_vertices());
+        sides[side].pred.resize(forward.num_vertices());
+        sides[side].stamp.assign(forward.num_vertices(), 0);
+        sides[side].queue.prepare(*graphs[side]);
+    }
+}
+
+void BidirectionalDijkstra::start_generation() {
+    if (++generation == 0) {
+        for (Side& side : sides) std::fill(side.stamp.begin(), side.stamp.end(), 0);
+        generation = 1;
+    }
+    for (Side& side : sides) side.queue.clear();
+    best = INF_DISTANCE;
+    meeting = NO_VERTEX;
+    settled = 0;
+}
+
+void BidirectionalDijkstra::settle_next(int s) {
+    Side& side = sides[s];
+    const Side& other = sides[1 - s];
+
+    std::pair<Distance, Vertex> top = side.queue.pop();
+    Distance d = top.first;
+    Vertex u = top.second;
+    if (d > side.dist[u]) return;
+    ++settled;
+
+    for (std::uint64_t e = side.graph->edge_begin(u); e < side.graph->edge_end(u); ++e) {
+        Vertex v = side.graph->target(e);
+        Distance nd = d + side.graph->weight(e);
+
+        if (!reached(s, v) || nd < side.dist[v]) {
+            side.stamp[v] = generation;
+            side.dist[v] = nd;
+            side.pred[v] = u;
+            side.queue.push(v, nd);
+
+            if (reached(1 - s, v) && nd + other.dist[v] < best) {
+                best = nd + other.dist[v];
+                meeting = v;
+            }
+        }
+    }
+}
+
+Distance BidirectionalDijkstra::run(Vertex source, Vertex target) {
+    start_generation();
+
+    Vertex ends[2] = {source, target};
+    for (int s = 0; s < 2; ++s) {
+        sides[s].stamp[ends[s]] = generation;
+        sides[s].dist[ends[s]] = 0;
+        sides[s].pred[ends[s]] = NO_VERTEX;
+        sides[s].queue.push(ends[s], 0);
+    }
+    if (source == target) {
+        best = 0;
+        meeting = source;
+    }
+
+    while (true) {
+        // Fila vazia conta como chave infinita
+        Distance top[2];
+        for (int s = 0; s < 2; ++s) {
+            top[s] = sides[s].queue.empty() ? INF_DISTANCE : sides[s].queue.top_key();
+        }
+        if (top[0] == INF_DISTANCE || top[1] == INF_DISTANCE || top[0] + top[1] >= best) break;
+
+        settle_next(top[0] <= top[1] ? 0 : 1);
+    }
+    return best;
+}
+
+std::vector<Vertex> BidirectionalDijkstra::path() const {
+    std::vector<Vertex> result;
+    if (meeting == NO_VERTEX) return result;
+
+    for (Vertex cur = meeting; cur != NO_VERTEX; cur = sides[0].pred[cur]) {
+        result.push_back(cur);
+    }
+    std::reverse(result.begin(), result.end());
+    for (Vertex cur = sides[1].pred[meeting]; cur != NO_VERTEX; cur = sides[1].pred[cur]) {
+        result.push_back(cur);
+    }
+    return result;
+}
@@ -0,0 +1,63 @@
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include "delta_stepping.h"
+#include "dijkstra.h"
+#include "grafos_teste.h"
+
+// Escalabilidade do delta-stepping de 1 a N threads.
+// Uso: bench_delta_stepping [max_threads] [num_vertices]
+
+double time_ms(DeltaStepping& solver, Vertex src) {
+    auto start = std::chrono::steady_clock::now();
+    solver.run(src);
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+void bench_graph(const std::string& title, Vertex n, const std::vector<Edge>& edges,
+                 unsigned max_threads) {
+    CSRGraph graph(n, edges);
+    std::cout << "\n" << title << ": V = " << n << ", E = " << graph.num_edges() << std::endl;
+
+    DijkstraQuery reference(graph);
+    auto start = std::chrono::steady_clock::now();
+    reference.run(0);
+    auto end = std::chrono::steady_clock::now();
+    double base = std::chrono::duration<double, std::milli>(end - start).count();
+    std::vector<Distance> expected, dist;
+    reference.copy_distances(expected);
+    std::cout << "  Dijkstra sequencial: " << std::fixed << std::setprecision(1) << base << " ms" << std::endl;
+
+    DeltaStepping solver(graph, 1);
+    double single = 0.0;
+    for (unsigned threads = 1; threads <= max_threads; threads *= 2) {
+        solver.set_num_threads(threads);
+        double ms = time_ms(solver, 0);
+        if (threads == 1) single = ms;
+        solver.copy_distances(dist);
+        std::cout << "  " << std::setw(3) << threads << " threads: " << std::setw(9) << ms << " ms"
+                  << "  speedup " << std::setprecision(2) << single / ms
+                  << "  (delta = " << solver.get_delta() << ", " << solver.phase_count() << " fases)"
+                  << (dist == expected ? "" : "  [DISTÂNCIAS DIVERGENTES]")
+                  << std::setprecision(1) << std::endl;
+    }
+}
+
+int main(int argc, char** argv) {
+    unsigned max_threads = argc > 1 ? std::atoi(argv[1]) : std::max(1u, std::thread::hardware_concurrency());
+    Vertex n = argc > 2 ? std::atoi(argv[2]) : 1000000;
+
+    std::cout << "BENCHMARK DO DELTA-STEPPING PARALELO" << std::endl;
+    std::cout << std::string(60, '=') << std::endl;
+
+    bench_graph("Aleatório (pesos 1..1000)", n, random_edges(n, 8ull * n, 1000, 1), max_threads);
+    Vertex side = 1;
+    while (static_cast<std::uint64_t>(side + 1) * (side + 1) <= n) ++side;
+    bench_graph("Grade (pesos 1..1000)", side * side, grid_edges(side, side, 1000, 2), max_threads);
+
+    return 0;
+}
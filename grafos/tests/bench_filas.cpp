@@ -0,0 +1,61 @@
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include "dijkstra.h"
+#include "grafos_teste.h"
+
+// Compara os backends de fila de BasicDijkstraQuery em grafos
+// aleatórios e em grade, com pesos pequenos e grandes.
+
+template <typename Query>
+void bench_queue(const std::string& name, const CSRGraph& graph, int queries,
+                 const std::vector<Distance>& expected_first) {
+    Query query(graph);
+    std::vector<Distance> dist;
+
+    auto start = std::chrono::steady_clock::now();
+    std::uint64_t checksum = 0;
+    for (int q = 0; q < queries; ++q) {
+        query.run(static_cast<Vertex>((q * 7919ull) % graph.num_vertices()));
+        checksum += query.settled_count();
+    }
+    auto end = std::chrono::steady_clock::now();
+    double ms = std::chrono::duration<double, std::milli>(end - start).count() / queries;
+
+    query.run(0);
+    query.copy_distances(dist);
+    std::cout << "  " << std::left << std::setw(14) << name << std::right
+              << std::fixed << std::setprecision(2) << std::setw(10) << ms << " ms/consulta"
+              << (dist == expected_first ? "" : "  [DISTÂNCIAS DIVERGENTES]")
+              << "  (" << checksum << " vértices fixados)" << std::endl;
+}
+
+void bench_graph(const std::string& title, Vertex n, const std::vector<Edge>& edges, int queries) {
+    CSRGraph graph(n, edges);
+    std::cout << "\n" << title << ": V = " << n << ", E = " << graph.num_edges()
+              << ", peso máximo = " << graph.max_weight() << std::endl;
+
+    std::vector<Distance> expected;
+    DijkstraQuery reference(graph);
+    reference.run(0);
+    reference.copy_distances(expected);
+
+    bench_queue<DijkstraQuery>("heap binário", graph, queries, expected);
+    bench_queue<QuaternaryDijkstraQuery>("heap 4-ário", graph, queries, expected);
+    bench_queue<RadixDijkstraQuery>("radix heap", graph, queries, expected);
+    bench_queue<DialDijkstraQuery>("Dial", graph, queries, expected);
+}
+
+int main() {
+    std::cout << "BENCHMARK DAS FILAS DE PRIORIDADE DO DIJKSTRA" << std::endl;
+    std::cout << std::string(60, '=') << std::endl;
+
+    const Vertex n = 1000000;
+    bench_graph("Aleatório (pesos 1..100)", n, random_edges(n, 4 * n, 100, 1), 5);
+    bench_graph("Aleatório (pesos 1..100000)", n, random_edges(n, 4 * n, 100000, 2), 5);
+    bench_graph("Grade 1000x1000 (pesos 1..100)", n, grid_edges(1000, 1000, 100, 3), 5);
+    bench_graph("Grade 1000x1000 (pesos 1..10000)", n, grid_edges(1000, 1000, 10000, 4), 5);
+
+    return 0;
+}
@@ -0,0 +1,70 @@
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include "alt.h"
+#include "dijkstra.h"
+#include "grafos_teste.h"
+#include "ponto_a_ponto.h"
+
+// Vértices fixados e tempo médio por consulta s -> t em uma grade grande.
+
+template <typename Run, typename Settled>
+void bench(const std::string& name, const std::vector<std::pair<Vertex, Vertex>>& queries,
+           Run run, Settled settled) {
+    std::uint64_t total_settled = 0;
+    Distance checksum = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (const auto& q : queries) {
+        checksum += run(q.first, q.second);
+        total_settled += settled();
+    }
+    auto end = std::chrono::steady_clock::now();
+    double ms = std::chrono::duration<double, std::milli>(end - start).count() / queries.size();
+    std::cout << "  " << std::left << std::setw(22) << name << std::right << std::fixed
+              << std::setprecision(3) << std::setw(10) << ms << " ms/consulta"
+              << std::setw(12) << total_settled / queries.size() << " fixados/consulta"
+              << "  (soma " << checksum << ")" << std::endl;
+}
+
+int main() {
+    const Vertex side = 1000;
+    CSRGraph graph(side * side, grid_edges(side, side, 100, 5));
+    CSRGraph reverse = graph.reversed();
+
+    std::cout << "BENCHMARK DE CONSULTAS PONTO A PONTO" << std::endl;
+    std::cout << "Grade " << side << "x" << side << ", E = " << graph.num_edges() << std::endl;
+    std::cout << std::string(60, '=') << std::endl;
+
+    auto start = std::chrono::steady_clock::now();
+    Landmarks::build(graph, 16).save("/tmp/bench_landmarks.alt");
+    auto end = std::chrono::steady_clock::now();
+    std::cout << "Pré-processamento de 16 marcos: "
+              << std::chrono::duration<double>(end - start).count() << " s" << std::endl;
+    Landmarks landmarks = Landmarks::load("/tmp/bench_landmarks.alt");
+
+    std::mt19937 gen(99);
+    std::uniform_int_distribution<Vertex> vertex_dist(0, graph.num_vertices() - 1);
+    std::vector<std::pair<Vertex, Vertex>> queries;
+    for (int i = 0; i < 50; ++i) queries.push_back({vertex_dist(gen), vertex_dist(gen)});
+
+    DijkstraQuery full(graph), early(graph);
+    BidirectionalDijkstra bidirectional(graph, reverse);
+    ALTQuery alt(graph, landmarks);
+
+    bench("SSSP completo", queries,
+          [&](Vertex s, Vertex t) { full.run(s); return full.distance(t); },
+          [&] { return full.settled_count(); });
+    bench("parada antecipada", queries,
+          [&](Vertex s, Vertex t) { return early.run(s, t); },
+          [&] { return early.settled_count(); });
+    bench("bidirecional", queries,
+          [&](Vertex s, Vertex t) { return bidirectional.run(s, t); },
+          [&] { return bidirectional.settled_count(); });
+    bench("ALT (16 marcos)", queries,
+          [&](Vertex s, Vertex t) { return alt.run(s, t); },
+          [&] { return alt.settled_count(); });
+
+    return 0;
+}
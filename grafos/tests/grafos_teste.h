@@ -0,0 +1,82 @@
+#ifndef GRAFOS_TESTE_H
+#define GRAFOS_TESTE_H
+
+// Utilitários compartilhados pelos testes e benchmarks de grafos:
+// geradores de grafos sintéticos e o Dijkstra de referência
+// (mesmo algoritmo de Dijkstra-modesto.cpp, devolvendo as distâncias).
+
+#include "grafo_csr.h"
+#include <functional>
+#include <queue>
+#include <random>
+#include <vector>
+
+inline std::vector<Edge> random_edges(Vertex num_vertices, std::uint64_t num_edges,
+                                      Weight max_weight, unsigned seed) {
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<Vertex> vertex_dist(0, num_vertices - 1);
+    std::uniform_int_distribution<Weight> weight_dist(1, max_weight);
+
+    std::vector<Edge> edges;
+    edges.reserve(num_edges);
+    for (std::uint64_t i = 0; i < num_edges; ++i) {
+        edges.push_back({vertex_dist(gen), vertex_dist(gen), weight_dist(gen)});
+    }
+    return edges;
+}
+
+// Grade rows x cols com arestas nos dois sentidos (parecida com malha viária)
+inline std::vector<Edge> grid_edges(Vertex rows, Vertex cols, Weight max_weight, unsigned seed) {
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<Weight> weight_dist(1, max_weight);
+
+    std::vector<Edge> edges;
+    for (Vertex r = 0; r < rows; ++r) {
+        for (Vertex c = 0; c < cols; ++c) {
+            Vertex u = r * cols + c;
+            if (c + 1 < cols) {
+                Weight w = weight_dist(gen);
+                edges.push_back({u, u + 1, w});
+                edges.push_back({u + 1, u, w});
+            }
+            if (r + 1 < rows) {
+                Weight w = weight_dist(gen);
+                edges.push_back({u, u + cols, w});
+                edges.push_back({u + cols, u, w});
+            }
+        }
+    }
+    return edges;
+}
+
+inline std::vector<Distance> reference_dijkstra(Vertex num_vertices, const std::vector<Edge>& edges,
+                                                Vertex src) {
+    typedef std::pair<Distance, Vertex> entry;
+    std::vector<std::vector<std::pair<Vertex, Weight>>> adj(num_vertices);
+    for (const Edge& edge : edges) {
+        adj[edge.from].push_back({edge.to, edge.weight});
+    }
+
+    std::vector<Distance> dist(num_vertices, INF_DISTANCE);
+    dist[src] = 0;
+    std::priority_queue<entry, std::vector<entry>, std::greater<entry>> pq;
+    pq.push({0, src});
+
+    while (!pq.empty()) {
+        Distance d = pq.top().first;
+        Vertex u = pq.top().second;
+        pq.pop();
+
+        if (d > dist[u]) continue;
+
+        for (auto& edge : adj[u]) {
+            if (d + edge.second < dist[edge.first]) {
+                dist[edge.first] = d + edge.second;
+                pq.push({dist[edge.first], edge.first});
+            }
+        }
+    }
+    return dist;
+}
+
+#endif
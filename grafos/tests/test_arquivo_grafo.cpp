@@ -0,0 +1,207 @@
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "arquivo_grafo.h"
+#include "dijkstra.h"
+#include "grafos_teste.h"
+#include "teste.h"
+
+bool same_graph(const CSRGraph& a, const CSRGraph& b) {
+    if (a.num_vertices() != b.num_vertices() || a.num_edges() != b.num_edges()) return false;
+    for (Vertex u = 0; u < a.num_vertices(); ++u) {
+        if (a.edge_begin(u) != b.edge_begin(u) || a.edge_end(u) != b.edge_end(u)) return false;
+    }
+    for (std::uint64_t e = 0; e < a.num_edges(); ++e) {
+        if (a.target(e) != b.target(e) || a.weight(e) != b.weight(e)) return false;
+    }
+    return true;
+}
+
+void test_dimacs() {
+    const Vertex n = 3000;
+    std::vector<Edge> edges = random_edges(n, 12000, 500, 31);
+    {
+        std::ofstream out("/tmp/test_grafo.gr");
+        out << "c grafo aleatório de teste\n";
+        out << "p sp " << n << " " << edges.size() << "\n";
+        for (const Edge& edge : edges) {
+            out << "a " << edge.from + 1 << " " << edge.to + 1 << " " << edge.weight << "\n";
+        }
+    }
+    convert_text_graph("/tmp/test_grafo.gr", TextGraphFormat::Dimacs, "/tmp/test_grafo.bin");
+    CSRGraph mapped = map_binary_graph("/tmp/test_grafo.bin");
+    CSRGraph expected(n, edges);
+    check(same_graph(mapped, expected), "DIMACS .gr convertido e mapeado é idêntico ao CSR em memória");
+
+    DijkstraQuery query(mapped);
+    query.run(0);
+    std::vector<Distance> dist;
+    query.copy_distances(dist);
+    check(dist == reference_dijkstra(n, edges, 0), "Dijkstra direto sobre o arquivo mapeado");
+
+    std::remove("/tmp/test_grafo.gr");
+    std::remove("/tmp/test_grafo.bin");
+}
+
+void test_edge_list() {
+    {
+        std::ofstream out("/tmp/test_grafo.txt");
+        out << "# lista de arestas\n";
+        out << "0 1 7\n";
+        out << "1 2\n";
+        out << "% outro comentário\n";
+        out << "\n";
+        out << "4 0 3\r\n";
+        out << "2 4 1";  // sem quebra de linha no final
+    }
+    convert_text_graph("/tmp/test_grafo.txt", TextGraphFormat::EdgeList, "/tmp/test_grafo.bin");
+    CSRGraph mapped = map_binary_graph("/tmp/test_grafo.bin");
+    CSRGraph expected(5, {{0, 1, 7}, {1, 2, 1}, {4, 0, 3}, {2, 4, 1}});
+    check(same_graph(mapped, expected), "lista de arestas com comentários, peso padrão e CRLF");
+
+    std::remove("/tmp/test_grafo.txt");
+    std::remove("/tmp/test_grafo.bin");
+}
+
+void test_save_and_errors() {
+    CSRGraph graph(2000, grid_edges(40, 50, 9, 32));
+    save_binary_graph(graph, "/tmp/test_grafo.bin");
+    check(same_graph(map_binary_graph("/tmp/test_grafo.bin"), graph), "save_binary_graph + map_binary_graph");
+
+    {
+        std::ofstream out("/tmp/test_grafo.bin", std::ios::binary | std::ios::app);
+        out << "lixo";
+    }
+    bool rejected = false;
+    try {
+        map_binary_graph("/tmp/test_grafo.bin");
+    } catch (const std::runtime_error&) {
+        rejected = true;
+    }
+    check(rejected, "arquivo com tamanho inconsistente é rejeitado");
+
+    {
+        std::ofstream out("/tmp/test_grafo.gr");
+        out << "p sp 3 1\na 1 9 2\n";
+    }
+    rejected = false;
+    try {
+        convert_text_graph("/tmp/test_grafo.gr", TextGraphFormat::Dimacs, "/tmp/test_grafo.bin");
+    } catch (const std::runtime_error&) {
+        rejected = true;
+    }
+    check(rejected, "aresta DIMACS fora de 1..n é rejeitada");
+
+    // Conteúdo corrompido com o tamanho certo: a verificação pega antes das consultas
+    auto corrupt = [](std::uint64_t position, std::uint64_t value, std::size_t bytes) {
+        CSRGraph small(4, {{0, 1, 2}, {1, 2, 3}, {2, 3, 4}});
+        save_binary_graph(small, "/tmp/test_grafo.bin");
+        std::fstream file("/tmp/test_grafo.bin", std::ios::binary | std::ios::in | std::ios::out);
+        file.seekp(static_cast<std::streamoff>(position));
+        file.write(reinterpret_cast<const char*>(&value), static_cast<std::streamsize>(bytes));
+    };
+    auto rejects = [](bool verify) {
+        try {
+            map_binary_graph("/tmp/test_grafo.bin", verify);
+        } catch (const std::runtime_error&) {
+            return true;
+        }
+        return false;
+    };
+    const std::uint64_t header_bytes = 32, offsets_bytes = 5 * 8;
+    corrupt(header_bytes + offsets_bytes + 4, 99, 4);  // destino da aresta 1 vira 99
+    bool bad_target = rejects(true);
+    bool trusted_load = !rejects(false);
+    corrupt(header_bytes + 2 * 8, 0, 8);  // offsets 0 1 0 3 3: decresce
+    check(bad_target && trusted_load && rejects(true),
+          "destino >= n e offsets decrescentes rejeitados (verify = false só mapeia)");
+    corrupt(8, ~std::uint64_t(0) / 2, 8);  // num_vertices com conta de tamanho estourando
+    bool huge_vertices = rejects(true);
+    corrupt(16, ~std::uint64_t(0) / 4 + 1, 8);  // num_edges idem
+    check(huge_vertices && rejects(false), "cabeçalho com n ou m cujo tamanho estoura 64 bits é rejeitado");
+
+    // Peso malformado ou lixo depois do último campo: erro, nunca um peso errado
+    struct BadLine {
+        TextGraphFormat format;
+        const char* text;
+        const char* description;
+    };
+    const BadLine bad_lines[] = {
+        {TextGraphFormat::EdgeList, "0 1 -5\n", "peso negativo"},
+        {TextGraphFormat::EdgeList, "1 2 7x\n", "lixo colado no peso"},
+        {TextGraphFormat::EdgeList, "2 0 1e3\n", "peso em notação científica"},
+        {TextGraphFormat::EdgeList, "0 1x\n", "lixo colado no destino"},
+        {TextGraphFormat::EdgeList, "0 1 7 lixo\n", "lixo depois do peso"},
+        {TextGraphFormat::Dimacs, "p sp 3 1\na 1 2 7x\n", "DIMACS: lixo colado no peso"},
+        {TextGraphFormat::Dimacs, "p sp 3 1\na 1 2 7 9\n", "DIMACS: campo a mais depois do peso"},
+        {TextGraphFormat::EdgeList, "0 1 18446744073709551617\n", "peso acima de 2^64 - 1"},
+        {TextGraphFormat::EdgeList, "18446744073709551616 1\n", "vértice que daria a volta para 0"},
+    };
+    for (const BadLine& bad : bad_lines) {
+        {
+            std::ofstream out("/tmp/test_grafo.txt");
+            out << bad.text;
+        }
+        rejected = false;
+        try {
+            convert_text_graph("/tmp/test_grafo.txt", bad.format, "/tmp/test_grafo.bin");
+        } catch (const std::runtime_error& error) {
+            rejected = std::string(error.what()).find("Linha") == 0;
+        }
+        check(rejected, std::string("rejeitado com número da linha: ") + bad.description);
+    }
+    std::remove("/tmp/test_grafo.txt");
+
+    // Texto que muda entre as passadas (um FIFO que entrega 3 arestas e
+    // depois 2): a falha na segunda passada não deixa arquivo carregável
+    auto changes_between_passes = [](const char* first, const char* second) {
+        const char* fifo = "/tmp/test_grafo.fifo";
+        std::remove(fifo);
+        std::remove("/tmp/test_grafo.bin");
+        ::mkfifo(fifo, 0644);
+        std::thread writer([&] {
+            std::ofstream(fifo) << first;
+            // A saída temporária só é criada depois que a primeira passada fecha o FIFO
+            while (::access("/tmp/test_grafo.bin.tmp", F_OK) != 0) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+            std::ofstream(fifo) << second;
+        });
+        bool failed = false;
+        try {
+            convert_text_graph(fifo, TextGraphFormat::EdgeList, "/tmp/test_grafo.bin");
+        } catch (const std::runtime_error&) {
+            failed = true;
+        }
+        writer.join();
+        std::remove(fifo);
+        std::ifstream leftover("/tmp/test_grafo.bin.tmp");
+        std::ifstream output("/tmp/test_grafo.bin");
+        return failed && !leftover && !output;
+    };
+    check(changes_between_passes("0 1\n0 2\n1 2\n", "0 1\n1 2\n"),
+          "arestas a menos na segunda passada: nenhum arquivo fica para trás");
+    check(changes_between_passes("0 1\n1 2\n", "0 1\n0 2\n1 2\n"),
+          "arestas a mais na segunda passada: nenhum arquivo fica para trás");
+
+    std::remove("/tmp/test_grafo.gr");
+    std::remove("/tmp/test_grafo.bin");
+}
+
+int main() {
+    std::cout << "TESTES DO FORMATO BINÁRIO DE GRAFOS" << std::endl;
+    std::cout << std::string(60, '=') << std::endl;
+
+    test_dimacs();
+    test_edge_list();
+    test_save_and_errors();
+
+    std::cout << std::string(60, '=') << std::endl;
+    return test_summary();
+}
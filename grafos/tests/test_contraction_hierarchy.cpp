@@ -0,0 +1,73 @@
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+#include <string>
+#include "contraction_hierarchy.h"
+#include "dijkstra.h"
+#include "grafos_teste.h"
+#include "teste.h"
+
+void test_graph(const std::string& name, Vertex n, const std::vector<Edge>& edges) {
+    CSRGraph graph(n, edges);
+
+    auto start = std::chrono::steady_clock::now();
+    ContractionHierarchy built = ContractionHierarchy::build(graph);
+    auto end = std::chrono::steady_clock::now();
+    std::cout << "        " << name << ": " << built.num_shortcuts() << " atalhos, pré-processamento em "
+              << std::chrono::duration<double, std::milli>(end - start).count() << " ms" << std::endl;
+
+    const std::string file = "/tmp/test_ch.idx";
+    built.save(file);
+    ContractionHierarchy ch = ContractionHierarchy::load(file);
+    std::remove(file.c_str());
+    check(ch.num_vertices() == n && ch.num_shortcuts() == built.num_shortcuts(),
+          name + ": índice salvo e recarregado do disco");
+
+    DijkstraQuery reference(graph);
+    CHQuery query(ch);
+    bool p2p_ok = true;
+    std::uint64_t settled_reference = 0, settled_ch = 0;
+    for (Vertex q = 0; q < 200; ++q) {
+        Vertex s = (q * 7919) % n;
+        Vertex t = (q * 104729 + 3) % n;
+        Distance expected = reference.run(s, t);
+        settled_reference += reference.settled_count();
+        p2p_ok = p2p_ok && query.run(s, t) == expected;
+        settled_ch += query.settled_count();
+    }
+    check(p2p_ok, name + ": 200 consultas s -> t batem com Dijkstra");
+    std::cout << "        vértices fixados: Dijkstra com parada antecipada " << settled_reference
+              << ", CH " << settled_ch << std::endl;
+
+    std::vector<Vertex> sources, targets;
+    for (Vertex i = 0; i < 15; ++i) sources.push_back((i * 31 + 5) % n);
+    for (Vertex j = 0; j < 20; ++j) targets.push_back((j * 53 + 9) % n);
+    std::vector<Distance> table, dist;
+    CHManyToMany many(ch);
+    many.run(sources, targets, table);
+
+    bool table_ok = table.size() == sources.size() * targets.size();
+    for (std::size_t i = 0; table_ok && i < sources.size(); ++i) {
+        reference.run(sources[i]);
+        reference.copy_distances(dist);
+        for (std::size_t j = 0; j < targets.size(); ++j) {
+            table_ok = table_ok && table[i * targets.size() + j] == dist[targets[j]];
+        }
+    }
+    check(table_ok, name + ": tabela 15 x 20 de muitos-para-muitos");
+}
+
+int main() {
+    std::cout << "TESTES DAS HIERARQUIAS DE CONTRAÇÃO" << std::endl;
+    std::cout << std::string(60, '=') << std::endl;
+
+    test_graph("grade 60x60", 3600, grid_edges(60, 60, 100, 21));
+    test_graph("aleatório", 1000, random_edges(1000, 3000, 100, 22));
+
+    std::vector<Edge> zero_weights = grid_edges(20, 20, 3, 23);
+    for (Edge& edge : zero_weights) edge.weight -= 1;
+    test_graph("grade com pesos zero", 400, zero_weights);
+
+    std::cout << std::string(60, '=') << std::endl;
+    return test_summary();
+}
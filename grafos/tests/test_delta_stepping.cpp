@@ -0,0 +1,39 @@
+#include <iostream>
+#include <string>
+#include "delta_stepping.h"
+#include "dijkstra.h"
+#include "grafos_teste.h"
+#include "teste.h"
+
+void test_graph(const std::string& name, Vertex n, const std::vector<Edge>& edges) {
+    CSRGraph graph(n, edges);
+    DijkstraQuery reference(graph);
+    std::vector<Distance> expected, dist;
+
+    for (unsigned threads : {1u, 2u, 4u}) {
+        for (Weight delta : {1u, 10u, 0u, 1000u}) {
+            DeltaStepping solver(graph, threads, delta);
+            bool all_equal = true;
+            for (Vertex src : {Vertex(0), Vertex(n / 2), Vertex(n - 1)}) {
+                reference.run(src);
+                reference.copy_distances(expected);
+                solver.run(src);
+                solver.copy_distances(dist);
+                all_equal = all_equal && dist == expected;
+            }
+            check(all_equal, name + ": " + std::to_string(threads) + " threads, delta = " +
+                             std::to_string(solver.get_delta()));
+        }
+    }
+}
+
+int main() {
+    std::cout << "TESTES DO DELTA-STEPPING" << std::endl;
+    std::cout << std::string(60, '=') << std::endl;
+
+    test_graph("aleatório", 3000, random_edges(3000, 15000, 100, 7));
+    test_graph("grade 40x40", 1600, grid_edges(40, 40, 50, 8));
+
+    std::cout << std::string(60, '=') << std::endl;
+    return test_summary();
+}
@@ -0,0 +1,64 @@
+#include <iostream>
+#include <string>
+#include "dijkstra.h"
+#include "grafos_teste.h"
+#include "teste.h"
+
+// Mesmo grafo de Dijkstra-modesto.cpp
+void test_small_graph() {
+    std::vector<std::vector<std::pair<int, int>>> adj(5);
+    adj[0].push_back({1, 9});
+    adj[0].push_back({2, 6});
+    adj[0].push_back({3, 5});
+    adj[0].push_back({4, 3});
+    adj[2].push_back({1, 2});
+    adj[2].push_back({3, 4});
+
+    CSRGraph graph = CSRGraph::from_adjacency(adj);
+    DijkstraQuery query(graph);
+    query.set_track_predecessors(true);
+    query.run(0);
+
+    std::vector<Distance> expected = {0, 8, 6, 5, 3};
+    std::vector<Distance> dist;
+    query.copy_distances(dist);
+    check(dist == expected, "distâncias do grafo de exemplo");
+
+    std::vector<Vertex> path = query.path_to(1);
+    check(path == std::vector<Vertex>({0, 2, 1}), "caminho 0 -> 1 passa por 2");
+
+    query.run(2);
+    check(query.distance(1) == 2 && query.distance(0) == INF_DISTANCE,
+          "consulta reaproveitada a partir de 2 não vê resíduos da anterior");
+}
+
+template <typename Query>
+void test_random_graph(const std::string& name) {
+    const Vertex n = 2000;
+    std::vector<Edge> edges = random_edges(n, 10000, 100, 42);
+    CSRGraph graph(n, edges);
+    Query query(graph);
+
+    bool all_equal = true;
+    std::vector<Distance> dist;
+    for (Vertex src = 0; src < 20; ++src) {
+        query.run(src * 97 % n);
+        query.copy_distances(dist);
+        all_equal = all_equal && dist == reference_dijkstra(n, edges, src * 97 % n);
+    }
+    check(all_equal, name + ": 20 consultas em grafo aleatório batem com a referência");
+}
+
+int main() {
+    std::cout << "TESTES DO DIJKSTRA EM CSR" << std::endl;
+    std::cout << std::string(60, '=') << std::endl;
+
+    test_small_graph();
+    test_random_graph<DijkstraQuery>("heap binário");
+    test_random_graph<DialDijkstraQuery>("Dial");
+    test_random_graph<RadixDijkstraQuery>("radix heap");
+    test_random_graph<QuaternaryDijkstraQuery>("heap 4-ário");
+
+    std::cout << std::string(60, '=') << std::endl;
+    return test_summary();
+}
@@ -0,0 +1,132 @@
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include "alt.h"
+#include "dijkstra.h"
+#include "grafos_teste.h"
+#include "ponto_a_ponto.h"
+#include "teste.h"
+
+// Soma os pesos do caminho; INF_DISTANCE se alguma aresta não existe
+Distance path_length(const CSRGraph& graph, const std::vector<Vertex>& path) {
+    Distance total = 0;
+    for (std::size_t i = 0; i + 1 < path.size(); ++i) {
+        Distance best = INF_DISTANCE;
+        for (std::uint64_t e = graph.edge_begin(path[i]); e < graph.edge_end(path[i]); ++e) {
+            if (graph.target(e) == path[i + 1]) best = std::min<Distance>(best, graph.weight(e));
+        }
+        if (best == INF_DISTANCE) return INF_DISTANCE;
+        total += best;
+    }
+    return total;
+}
+
+void test_graph(const std::string& name, Vertex n, const std::vector<Edge>& edges) {
+    CSRGraph graph(n, edges);
+    CSRGraph reverse = graph.reversed();
+
+    const std::string file = "/tmp/test_landmarks.alt";
+    Landmarks::build(graph, 8).save(file);
+    Landmarks landmarks = Landmarks::load(file);
+    std::remove(file.c_str());
+
+    DijkstraQuery full(graph);
+    DijkstraQuery early(graph);
+    BidirectionalDijkstra bidirectional(graph, reverse);
+    ALTQuery alt(graph, landmarks);
+
+    bool early_ok = true, bidir_ok = true, alt_ok = true, paths_ok = true;
+    std::uint64_t settled_full = 0, settled_early = 0, settled_bidir = 0, settled_alt = 0;
+    for (Vertex q = 0; q < 50; ++q) {
+        Vertex s = (q * 7919) % n;
+        Vertex t = (q * 104729 + 17) % n;
+        full.run(s);
+        Distance expected = full.distance(t);
+        settled_full += full.settled_count();
+
+        early_ok = early_ok && early.run(s, t) == expected;
+        settled_early += early.settled_count();
+
+        bidir_ok = bidir_ok && bidirectional.run(s, t) == expected;
+        settled_bidir += bidirectional.settled_count();
+        if (expected != INF_DISTANCE) {
+            paths_ok = paths_ok && path_length(graph, bidirectional.path()) == expected;
+        }
+
+        alt_ok = alt_ok && alt.run(s, t) == expected;
+        settled_alt += alt.settled_count();
+        if (expected != INF_DISTANCE) {
+            paths_ok = paths_ok && path_length(graph, alt.path()) == expected;
+        }
+    }
+
+    check(early_ok, name + ": Dijkstra com parada antecipada");
+    check(bidir_ok, name + ": Dijkstra bidirecional");
+    check(alt_ok, name + ": ALT com marcos salvos e recarregados do disco");
+    check(paths_ok, name + ": caminhos reconstruídos têm o comprimento ótimo");
+    check(settled_alt < settled_full, name + ": ALT fixa menos vértices que o SSSP completo");
+    std::cout << "        vértices fixados (50 consultas): completo " << settled_full
+              << ", parada antecipada " << settled_early << ", bidirecional " << settled_bidir
+              << ", ALT " << settled_alt << std::endl;
+}
+
+// Sem marcos o limite inferior é 0 e ALT responde como Dijkstra
+void test_no_landmarks() {
+    CSRGraph graph(2000, random_edges(2000, 10000, 100, 13));
+    Landmarks none = Landmarks::build(graph, 0);
+    DijkstraQuery full(graph);
+    ALTQuery alt(graph, none);
+    bool ok = none.count() == 0;
+    for (Vertex q = 0; q < 20; ++q) {
+        Vertex s = (q * 7919) % 2000;
+        Vertex t = (q * 104729 + 17) % 2000;
+        full.run(s);
+        ok = ok && alt.run(s, t) == full.distance(t);
+    }
+    check(ok, "ALT com zero marcos dá as distâncias do Dijkstra");
+}
+
+// Cabeçalho corrompido: exceção antes de alocar n * k entradas
+void test_corrupt_landmarks() {
+    const std::string file = "/tmp/test_landmarks.alt";
+    CSRGraph graph(100, random_edges(100, 400, 100, 14));
+    // Reescreve n e k (offsets 8 e 16, logo depois do magic)
+    auto corrupt_loads = [&](std::uint64_t n, std::uint64_t k) {
+        Landmarks::build(graph, 4).save(file);
+        {
+            std::uint64_t header[2] = {n, k};
+            std::fstream out(file, std::ios::binary | std::ios::in | std::ios::out);
+            out.seekp(8);
+            out.write(reinterpret_cast<const char*>(header), sizeof(header));
+        }
+        try {
+            Landmarks::load(file);
+        } catch (const std::runtime_error&) {
+            return false;
+        }
+        return true;
+    };
+    bool intact = corrupt_loads(100, 4);
+    bool huge_k = corrupt_loads(100, std::uint64_t(1) << 40);
+    bool huge_n = corrupt_loads(std::uint64_t(1) << 33, 4);
+    bool overflow = corrupt_loads(0xFFFFFFFEull, std::uint64_t(1) << 31);  // 8 n k passa de 2^64
+    bool wrong_size = corrupt_loads(101, 4);
+    std::remove(file.c_str());
+    check(intact && !huge_k && !huge_n && !overflow && !wrong_size,
+          "marcos com n, k, n * k ou tamanho inconsistentes são rejeitados");
+}
+
+int main() {
+    std::cout << "TESTES DE CONSULTAS PONTO A PONTO" << std::endl;
+    std::cout << std::string(60, '=') << std::endl;
+
+    test_graph("aleatório", 5000, random_edges(5000, 25000, 100, 11));
+    test_graph("grade 80x80", 6400, grid_edges(80, 80, 100, 12));
+    test_no_landmarks();
+    test_corrupt_landmarks();
+
+    std::cout << std::string(60, '=') << std::endl;
+    return test_summary();
+}
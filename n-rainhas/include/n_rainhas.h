@@ -0,0 +1,43 @@
+#ifndef N_RAINHAS_H
+#define N_RAINHAS_H
+
+#include <cstdint>
+#include <vector>
+
+class ThreadPool;
+
+/**
+ * N-Rainhas com tabuleiro em bits
+ *
+ * Objetivo:
+ *   Contar todas as soluções do problema das N-Rainhas (N até 32).
+ *   Em vez de guardar a matriz NxN e reexaminar coluna e diagonais a
+ *   cada tentativa (isSafe em N-Queens.cpp), a busca carrega três
+ *   máscaras: colunas ocupadas, diagonais "\" e diagonais "/" que
+ *   atacam a linha atual. As casas livres são
+ *       ~(colunas | diag_esq | diag_dir) & todas
+ *   e ao descer uma linha as diagonais só deslocam um bit. Cada
+ *   tentativa custa O(1).
+ *
+ *   A versão paralela enumera os prefixos válidos das primeiras
+ *   split_depth linhas e entrega cada subárvore como tarefa ao
+ *   ThreadPool; workers ociosos roubam subárvores dos outros, o que
+ *   equilibra árvores de tamanhos bem diferentes.
+ *
+ * Complexidade:
+ *   - Tempo: O(N!) no pior caso, com O(1) por nó
+ *   - Espaço: O(N) (pilha de recursão)
+ */
+
+struct NQueensCount {
+    std::uint64_t solutions;
+    std::uint64_t nodes;  // rainhas colocadas durante a busca
+};
+
+NQueensCount count_n_queens(int n);
+NQueensCount count_n_queens_parallel(int n, ThreadPool& pool, int split_depth = 2);
+
+// Primeira solução em ordem lexicográfica: columns[linha] = coluna
+bool solve_n_queens(int n, std::vector<int>& columns);
+
+#endif
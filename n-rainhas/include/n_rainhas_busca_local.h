@@ -0,0 +1,50 @@
+#ifndef N_RAINHAS_BUSCA_LOCAL_H
+#define N_RAINHAS_BUSCA_LOCAL_H
+
+#include <cstdint>
+#include <vector>
+
+/**
+ * N-Rainhas por busca local (mínimos conflitos sobre permutações)
+ *
+ * Objetivo:
+ *   Encontrar uma solução para N na casa dos milhões, onde o
+ *   backtracking de N-Queens.cpp não termina e a matriz NxN nem cabe na
+ *   memória. O tabuleiro é uma permutação: columns[linha] = coluna.
+ *   Por ser permutação, cada coluna tem exatamente uma rainha e o
+ *   contador de colunas é sempre 1; só as diagonais podem conflitar.
+ *   Dois contadores guardam quantas rainhas há em cada diagonal "\"
+ *   (linha + coluna) e "/" (linha - coluna + N - 1).
+ *
+ *   Segue a estratégia QS4 de Sosic e Gu:
+ *     1. Construção gulosa: para cada linha, troca a sua coluna por
+ *        uma aleatória das linhas seguintes até achar uma casa sem
+ *        conflito de diagonal. As últimas linhas (poucas dezenas) são
+ *        colocadas ao acaso, onde a busca gulosa ficaria cara.
+ *     2. Reparo: para cada rainha atacada, sorteia outra linha e troca
+ *        as colunas das duas se isso diminuir o número de colisões.
+ *        A troca mantém a permutação e atualiza só 8 contadores.
+ *   Sobram tipicamente menos de 100 rainhas em conflito após a etapa 1,
+ *   então o reparo custa pouco perto da construção.
+ *
+ * Complexidade:
+ *   - Tempo: O(N) esperado
+ *   - Espaço: O(N) (permutação + 2 contadores por diagonal)
+ */
+
+struct MinConflictsStats {
+    std::uint64_t swaps;     // trocas aceitas no reparo
+    std::uint64_t attempts;  // trocas avaliadas no reparo
+    std::uint32_t initial_conflicts;  // rainhas atacadas após a construção
+    std::uint32_t restarts;
+};
+
+// Falso se não há solução (N = 2 ou 3) ou se max_restarts se esgotou
+bool solve_n_queens_min_conflicts(std::uint32_t n, std::vector<std::uint32_t>& columns,
+                                  std::uint64_t seed = 42, MinConflictsStats* stats = nullptr,
+                                  std::uint32_t max_restarts = 100);
+
+// Confere em O(N) se columns é uma permutação sem rainhas em diagonal
+bool verify_n_queens(const std::vector<std::uint32_t>& columns);
+
+#endif
@@ -0,0 +1,153 @@
+#ifndef N_RAINHAS_SIMETRIA_H
+#define N_RAINHAS_SIMETRIA_H
+
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+
+/**
+ * N-Rainhas com redução por simetria
+ *
+ * Objetivo:
+ *   O tabuleiro tem 8 simetrias (4 rotações x espelhamento). A busca
+ *   explora só metade da primeira linha: toda solução com a rainha da
+ *   linha 0 na metade direita é o espelho de uma da metade esquerda,
+ *   então cada solução encontrada vale 2. Com N ímpar, a coluna do
+ *   meio é tratada à parte: o espelho mantém a rainha da linha 0 no
+ *   meio, então limitamos a linha 1 à metade esquerda (ela nunca pode
+ *   ficar no meio) e cada solução também vale 2.
+ *
+ *   Para separar soluções únicas (classes de simetria) do total, cada
+ *   solução encontrada é comparada com as suas 8 transformações; ela é
+ *   a representante da classe se for a menor em ordem lexicográfica.
+ *   A representante sempre cai no espaço explorado (menor coluna na
+ *   linha 0 e, se for o meio, menor coluna na linha 1).
+ *
+ *   A busca é constexpr: para N <= COMPILE_TIME_MAX_N as contagens são
+ *   calculadas pelo compilador (CompileTimeNQueens<N> e a tabela
+ *   SMALL_N_QUEENS_TABLE) e consultá-las não custa nada em execução.
+ *
+ * Complexidade:
+ *   - Tempo: cerca de metade dos nós da busca completa, mais O(8N) por
+ *     solução para classificar
+ *   - Espaço: O(N)
+ */
+
+struct NQueensSymmetryCount {
+    std::uint64_t total;
+    std::uint64_t unique;
+    std::uint64_t nodes;
+};
+
+namespace n_queens_detail {
+
+// Compara a transformação t da permutação p com a própria p.
+// Transformações: bit 0 = espelho horizontal, bit 1 = espelho vertical,
+// bit 2 = usar a inversa (transposição).
+constexpr bool transform_is_smaller(const int* p, const int* inverse, int n, int t) {
+    const int* base = (t & 4) ? inverse : p;
+    for (int r = 0; r < n; ++r) {
+        int row = (t & 2) ? n - 1 - r : r;
+        int col = (t & 1) ? n - 1 - base[row] : base[row];
+        if (col != p[r]) return col < p[r];
+    }
+    return false;
+}
+
+constexpr bool is_canonical(const int* p, int n) {
+    int inverse[32] = {};
+    for (int r = 0; r < n; ++r) inverse[p[r]] = r;
+    for (int t = 1; t < 8; ++t) {
+        if (transform_is_smaller(p, inverse, n, t)) return false;
+    }
+    return true;
+}
+
+constexpr void search(int n, std::uint32_t all, int row, std::uint32_t columns,
+                      std::uint32_t left, std::uint32_t right, int* p,
+                      NQueensSymmetryCount& counts) {
+    if (columns == all) {
+        counts.total += 2;
+        if (is_canonical(p, n)) ++counts.unique;
+        return;
+    }
+    std::uint32_t free = all & ~(columns | left | right);
+    while (free) {
+        std::uint32_t bit = free & (0u - free);
+        free ^= bit;
+        ++counts.nodes;
+        p[row] = __builtin_ctz(bit);
+        search(n, all, row + 1, columns | bit, (left | bit) << 1, (right | bit) >> 1, p, counts);
+    }
+}
+
+constexpr NQueensSymmetryCount count_symmetric(int n) {
+    NQueensSymmetryCount counts = {0, 0, 0};
+    if (n == 1) return {1, 1, 1};
+
+    const std::uint32_t all = n == 32 ? 0xFFFFFFFFu : (1u << n) - 1;
+    const int half = n / 2;
+    int p[32] = {};
+
+    // Linha 0 na metade esquerda
+    for (int col = 0; col < half; ++col) {
+        std::uint32_t bit = 1u << col;
+        ++counts.nodes;
+        p[0] = col;
+        search(n, all, 1, bit, bit << 1, bit >> 1, p, counts);
+    }
+
+    // N ímpar: linha 0 no meio, linha 1 restrita à metade esquerda
+    if (n % 2 == 1) {
+        std::uint32_t bit = 1u << half;
+        ++counts.nodes;
+        p[0] = half;
+        std::uint32_t left = bit << 1, right = bit >> 1;
+        std::uint32_t free = ((1u << half) - 1) & ~(left | right);
+        while (free) {
+            std::uint32_t second = free & (0u - free);
+            free ^= second;
+            ++counts.nodes;
+            p[1] = __builtin_ctz(second);
+            search(n, all, 2, bit | second, (left | second) << 1, (right | second) >> 1, p, counts);
+        }
+    }
+    return counts;
+}
+
+template <std::size_t... Ns>
+constexpr auto make_table(std::index_sequence<Ns...>) {
+    struct Table {
+        NQueensSymmetryCount counts[sizeof...(Ns)];
+    };
+    return Table{{count_symmetric(static_cast<int>(Ns) + 1)...}};
+}
+
+}
+
+constexpr int COMPILE_TIME_MAX_N = 11;
+
+// Contagens de um N fixo calculadas em tempo de compilação
+template <int N>
+struct CompileTimeNQueens {
+    static_assert(N >= 1 && N <= 32, "N-Rainhas: N deve estar entre 1 e 32");
+    static constexpr NQueensSymmetryCount value = n_queens_detail::count_symmetric(N);
+};
+
+// SMALL_N_QUEENS_TABLE.counts[N - 1] para N = 1..COMPILE_TIME_MAX_N
+constexpr auto SMALL_N_QUEENS_TABLE =
+    n_queens_detail::make_table(std::make_index_sequence<COMPILE_TIME_MAX_N>());
+
+// Busca com redução por simetria em tempo de execução
+inline NQueensSymmetryCount count_n_queens_symmetric(int n) {
+    if (n < 1 || n > 32) throw std::invalid_argument("N-Rainhas: N deve estar entre 1 e 32");
+    return n_queens_detail::count_symmetric(n);
+}
+
+// Tabela pré-calculada para N pequeno; busca com simetria acima disso
+inline NQueensSymmetryCount n_queens_counts(int n) {
+    if (n >= 1 && n <= COMPILE_TIME_MAX_N) return SMALL_N_QUEENS_TABLE.counts[n - 1];
+    return count_n_queens_symmetric(n);
+}
+
+#endif
@@ -0,0 +1,105 @@
+#include "n_rainhas.h"
+#include "thread_pool.h"
+#include <stdexcept>
+
+namespace {
+
+struct BoardState {
+    std::uint32_t columns;
+    std::uint32_t left;   // diagonais "\" que atacam a linha atual
+    std::uint32_t right;  // diagonais "/" que atacam a linha atual
+};
+
+std::uint32_t full_mask(int n) {
+    if (n < 1 || n > 32) throw std::invalid_argument("N-Rainhas: N deve estar entre 1 e 32");
+    return n == 32 ? 0xFFFFFFFFu : (1u << n) - 1;
+}
+
+BoardState place(const BoardState& state, std::uint32_t bit) {
+    return {state.columns | bit, (state.left | bit) << 1, (state.right | bit) >> 1};
+}
+
+std::uint64_t count_from(const BoardState& state, std::uint32_t all, std::uint64_t& nodes) {
+    if (state.columns == all) return 1;
+
+    std::uint64_t total = 0;
+    std::uint32_t free = all & ~(state.columns | state.left | state.right);
+    while (free) {
+        std::uint32_t bit = free & (0u - free);  // casa livre mais à direita
+        free ^= bit;
+        ++nodes;
+        total += count_from(place(state, bit), all, nodes);
+    }
+    return total;
+}
+
+// Prefixos válidos das primeiras depth linhas (ou tabuleiros completos)
+void collect_prefixes(const BoardState& state, std::uint32_t all, int depth,
+                      std::vector<BoardState>& prefixes, std::uint64_t& nodes) {
+    if (depth == 0 || state.columns == all) {
+        prefixes.push_back(state);
+        return;
+    }
+    std::uint32_t free = all & ~(state.columns | state.left | state.right);
+    while (free) {
+        std::uint32_t bit = free & (0u - free);
+        free ^= bit;
+        ++nodes;
+        collect_prefixes(place(state, bit), all, depth - 1, prefixes, nodes);
+    }
+}
+
+bool solve_from(const BoardState& state, std::uint32_t all, int row, std::vector<int>& columns) {
+    if (state.columns == all) return true;
+
+    std::uint32_t free = all & ~(state.columns | state.left | state.right);
+    while (free) {
+        std::uint32_t bit = free & (0u - free);
+        free ^= bit;
+        columns[row] = __builtin_ctz(bit);
+        if (solve_from(place(state, bit), all, row + 1, columns)) return true;
+    }
+    return false;
+}
+
+}
+
+NQueensCount count_n_queens(int n) {
+    std::uint32_t all = full_mask(n);
+    NQueensCount result = {0, 0};
+    result.solutions = count_from({0, 0, 0}, all, result.nodes);
+    return result;
+}
+
+NQueensCount count_n_queens_parallel(int n, ThreadPool& pool, int split_depth) {
+    std::uint32_t all = full_mask(n);
+    NQueensCount result = {0, 0};
+
+    std::vector<BoardState> prefixes;
+    collect_prefixes({0, 0, 0}, all, split_depth, prefixes, result.nodes);
+
+    // Cada subárvore escreve no seu próprio slot: nada de contadores compartilhados
+    std::vector<NQueensCount> partial(prefixes.size(), NQueensCount{0, 0});
+    TaskGroup group(pool);
+    for (std::size_t i = 0; i < prefixes.size(); ++i) {
+        group.run([&, i] {
+            // Contador local: evita falso compartilhamento entre slots vizinhos
+            std::uint64_t nodes = 0;
+            partial[i].solutions = count_from(prefixes[i], all, nodes);
+            partial[i].nodes = nodes;
+        });
+    }
+    group.wait();
+
+    for (const NQueensCount& part : partial) {
+        result.solutions += part.solutions;
+        result.nodes += part.nodes;
+    }
+    return result;
+}
+
+bool solve_n_queens(int n, std::vector<int>& columns) {
+    std::uint32_t all = full_mask(n);
+    columns.assign(n, -1);
+    return solve_from({0, 0, 0}, all, 0, columns);
+}
@@ -0,0 +1,175 @@
+#include "n_rainhas_busca_local.h"
+#include <algorithm>
+#include <numeric>
+
+namespace {
+
+// Linhas finais colocadas ao acaso na construção (QS4)
+const std::uint32_t RANDOM_TAIL = 64;
+// Tentativas por linha na construção gulosa antes de desistir
+const std::uint32_t GREEDY_TRIES = 128;
+
+struct SplitMix64 {
+    std::uint64_t state;
+
+    std::uint64_t next() {
+        std::uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        return z ^ (z >> 31);
+    }
+
+    // Uniforme em [0, bound) sem divisão (Lemire)
+    std::uint32_t below(std::uint32_t bound) {
+        return static_cast<std::uint32_t>(((next() >> 32) * bound) >> 32);
+    }
+};
+
+class Board {
+public:
+    explicit Board(std::vector<std::uint32_t>& columns)
+        : columns(columns), n(static_cast<std::uint32_t>(columns.size())),
+          down(2 * columns.size(), 0), up(2 * columns.size(), 0) {}
+
+    std::uint32_t& down_of(std::uint32_t row, std::uint32_t col) { return down[row + col]; }
+    std::uint32_t& up_of(std::uint32_t row, std::uint32_t col) { return up[row + n - 1 - col]; }
+
+    bool free(std::uint32_t row, std::uint32_t col) {
+        return down_of(row, col) == 0 && up_of(row, col) == 0;
+    }
+
+    void add(std::uint32_t row) {
+        ++down_of(row, columns[row]);
+        ++up_of(row, columns[row]);
+    }
+
+    bool attacked(std::uint32_t row) {
+        return down_of(row, columns[row]) > 1 || up_of(row, columns[row]) > 1;
+    }
+
+    // Colisões = soma de (rainhas - 1) por diagonal ocupada
+    long remove_delta(std::uint32_t row) {
+        std::uint32_t& d = down_of(row, columns[row]);
+        std::uint32_t& u = up_of(row, columns[row]);
+        long delta = -static_cast<long>(d > 1) - static_cast<long>(u > 1);
+        --d;
+        --u;
+        return delta;
+    }
+
+    long add_delta(std::uint32_t row) {
+        std::uint32_t& d = down_of(row, columns[row]);
+        std::uint32_t& u = up_of(row, columns[row]);
+        long delta = static_cast<long>(d > 0) + static_cast<long>(u > 0);
+        ++d;
+        ++u;
+        return delta;
+    }
+
+    // Troca as colunas de a e b; devolve a variação de colisões
+    long swap_rows(std::uint32_t a, std::uint32_t b) {
+        long delta = remove_delta(a) + remove_delta(b);
+        std::swap(columns[a], columns[b]);
+        return delta + add_delta(a) + add_delta(b);
+    }
+
+    std::vector<std::uint32_t>& columns;
+    std::uint32_t n;
+
+private:
+    std::vector<std::uint32_t> down;  // linha + coluna
+    std::vector<std::uint32_t> up;    // linha - coluna + N - 1
+};
+
+// Etapa 1: devolve as linhas atacadas após a construção
+std::vector<std::uint32_t> build(Board& board, SplitMix64& rng) {
+    std::uint32_t n = board.n;
+    std::vector<std::uint32_t>& columns = board.columns;
+    std::iota(columns.begin(), columns.end(), 0u);
+
+    std::uint32_t greedy = n > RANDOM_TAIL ? n - RANDOM_TAIL : 0;
+    for (std::uint32_t row = 0; row < n; ++row) {
+        std::uint32_t tries = row < greedy ? GREEDY_TRIES : 1;
+        for (std::uint32_t t = 0; t < tries; ++t) {
+            std::swap(columns[row], columns[row + rng.below(n - row)]);
+            if (board.free(row, columns[row])) break;
+        }
+        board.add(row);
+    }
+
+    std::vector<std::uint32_t> conflicts;
+    for (std::uint32_t row = 0; row < n; ++row) {
+        if (board.attacked(row)) conflicts.push_back(row);
+    }
+    return conflicts;
+}
+
+// Etapa 2: trocas aleatórias que diminuem as colisões
+bool repair(Board& board, std::vector<std::uint32_t> conflicts, SplitMix64& rng,
+            MinConflictsStats& stats) {
+    std::uint32_t n = board.n;
+    std::uint64_t budget = 20ull * n + 100000;  // tentativas antes de recomeçar
+    std::vector<std::uint32_t> next;
+
+    // Toda colisão envolve ao menos uma linha da lista: as novas só
+    // aparecem em diagonais para onde uma linha trocada se moveu
+    while (!conflicts.empty()) {
+        next.clear();
+        for (std::uint32_t row : conflicts) {
+            while (board.attacked(row)) {
+                ++stats.attempts;
+                if (budget-- == 0) return false;
+                std::uint32_t other = rng.below(n);
+                if (other == row) continue;
+                if (board.swap_rows(row, other) < 0) {
+                    ++stats.swaps;
+                    next.push_back(other);
+                    break;
+                }
+                board.swap_rows(row, other);  // desfaz
+            }
+            if (board.attacked(row)) next.push_back(row);
+        }
+        std::sort(next.begin(), next.end());
+        next.erase(std::unique(next.begin(), next.end()), next.end());
+        conflicts.clear();
+        for (std::uint32_t row : next) {
+            if (board.attacked(row)) conflicts.push_back(row);
+        }
+    }
+    return true;
+}
+
+}
+
+bool solve_n_queens_min_conflicts(std::uint32_t n, std::vector<std::uint32_t>& columns,
+                                  std::uint64_t seed, MinConflictsStats* stats,
+                                  std::uint32_t max_restarts) {
+    MinConflictsStats local = {0, 0, 0, 0};
+    MinConflictsStats& s = stats ? *stats : local;
+    s = local;
+
+    columns.assign(n, 0);
+    if (n == 0 || n == 2 || n == 3) return n == 0;
+
+    SplitMix64 rng = {seed};
+    for (std::uint32_t attempt = 0; attempt <= max_restarts; ++attempt) {
+        s.restarts = attempt;
+        Board board(columns);
+        std::vector<std::uint32_t> conflicts = build(board, rng);
+        if (attempt == 0) s.initial_conflicts = static_cast<std::uint32_t>(conflicts.size());
+        if (repair(board, std::move(conflicts), rng, s)) return true;
+    }
+    return false;
+}
+
+bool verify_n_queens(const std::vector<std::uint32_t>& columns) {
+    std::size_t n = columns.size();
+    std::vector<bool> column_used(n, false), down(2 * n, false), up(2 * n, false);
+    for (std::size_t row = 0; row < n; ++row) {
+        std::size_t col = columns[row];
+        if (col >= n || column_used[col] || down[row + col] || up[row + n - 1 - col]) return false;
+        column_used[col] = down[row + col] = up[row + n - 1 - col] = true;
+    }
+    return true;
+}
@@ -0,0 +1,124 @@
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "n_rainhas.h"
+#include "n_rainhas_simetria.h"
+#include "thread_pool.h"
+
+// Compara o tabuleiro em bits (sequencial e paralelo) com a versão
+// de N-Queens.cpp (matriz NxN + isSafe).
+// Uso: bench_n_rainhas [n_max] [threads]
+
+using namespace std;
+
+// --- Reprodução de N-Queens.cpp ------------------------------------------
+bool isSafe(const vector<vector<int>>& board, int row, int col, int N) {
+    for (int i = 0; i < row; i++)
+        if (board[i][col]) return false;
+    for (int i = row, j = col; i >= 0 && j >= 0; i--, j--)
+        if (board[i][j]) return false;
+    for (int i = row, j = col; i >= 0 && j < N; i--, j++)
+        if (board[i][j]) return false;
+    return true;
+}
+
+bool solveNQueens(vector<vector<int>>& board, int row, int N) {
+    if (row >= N) return true;
+    for (int col = 0; col < N; col++) {
+        if (isSafe(board, row, col, N)) {
+            board[row][col] = 1;
+            if (solveNQueens(board, row + 1, N)) return true;
+            board[row][col] = 0;
+        }
+    }
+    return false;
+}
+
+// Mesma busca, mas continuando depois de cada solução para contar todas
+uint64_t countNQueens(vector<vector<int>>& board, int row, int N, uint64_t& nodes) {
+    if (row >= N) return 1;
+    uint64_t total = 0;
+    for (int col = 0; col < N; col++) {
+        if (isSafe(board, row, col, N)) {
+            ++nodes;
+            board[row][col] = 1;
+            total += countNQueens(board, row + 1, N, nodes);
+            board[row][col] = 0;
+        }
+    }
+    return total;
+}
+// -------------------------------------------------------------------------
+
+template <typename Fn>
+double seconds(Fn fn) {
+    auto start = chrono::steady_clock::now();
+    fn();
+    auto end = chrono::steady_clock::now();
+    return chrono::duration<double>(end - start).count();
+}
+
+int main(int argc, char** argv) {
+    int n_max = argc > 1 ? atoi(argv[1]) : 16;
+    unsigned threads = argc > 2 ? atoi(argv[2]) : 0;
+    ThreadPool pool(threads);
+
+    cout << "BENCHMARK DAS N-RAINHAS (" << pool.size() << " threads)" << endl;
+    cout << string(100, '=') << endl;
+    cout << setw(3) << "N" << setw(14) << "soluções" << setw(16) << "matriz (s)"
+         << setw(14) << "bits (s)" << setw(14) << "paralelo (s)"
+         << setw(16) << "Mnós/s (par.)" << setw(12) << "x matriz" << setw(12) << "x bits" << endl;
+
+    for (int n = 8; n <= n_max; ++n) {
+        NQueensCount bits = {0, 0}, parallel = {0, 0};
+        double t_bits = seconds([&] { bits = count_n_queens(n); });
+        double t_parallel = seconds([&] { parallel = count_n_queens_parallel(n, pool, 2); });
+
+        // A versão com matriz fica inviável rapidamente
+        double t_board = -1.0;
+        if (n <= 14) {
+            vector<vector<int>> board(n, vector<int>(n, 0));
+            uint64_t nodes = 0;
+            t_board = seconds([&] { countNQueens(board, 0, n, nodes); });
+        }
+
+        cout << setw(3) << n << setw(14) << parallel.solutions << fixed << setprecision(4)
+             << setw(16) << (t_board < 0 ? string("-") : to_string(t_board))
+             << setw(14) << t_bits << setw(14) << t_parallel
+             << setw(16) << setprecision(1) << parallel.nodes / t_parallel / 1e6
+             << setw(12) << (t_board < 0 ? string("-") : to_string(int(t_board / t_parallel)))
+             << setw(12) << setprecision(2) << t_bits / t_parallel
+             << (bits.solutions == parallel.solutions ? "" : "  [DIVERGENTE]") << endl;
+    }
+
+    // Redução por simetria: metade da primeira linha, únicas x total
+    cout << "\nSimetria:" << endl;
+    cout << setw(3) << "N" << setw(14) << "total" << setw(12) << "únicas" << setw(14) << "bits (s)"
+         << setw(16) << "simetria (s)" << setw(12) << "x bits" << setw(14) << "nós / bits" << endl;
+    for (int n = 8; n <= n_max; ++n) {
+        NQueensCount bits = {0, 0};
+        NQueensSymmetryCount symmetric = {0, 0, 0};
+        double t_bits = seconds([&] { bits = count_n_queens(n); });
+        double t_symmetric = seconds([&] { symmetric = count_n_queens_symmetric(n); });
+        cout << setw(3) << n << setw(14) << symmetric.total << setw(12) << symmetric.unique
+             << fixed << setprecision(4) << setw(14) << t_bits << setw(16) << t_symmetric
+             << setw(12) << setprecision(2) << t_bits / t_symmetric
+             << setw(14) << double(symmetric.nodes) / bits.nodes
+             << (bits.solutions == symmetric.total ? "" : "  [DIVERGENTE]") << endl;
+    }
+
+    // Primeira solução, o que N-Queens.cpp de fato calcula
+    cout << "\nPrimeira solução:" << endl;
+    for (int n : {20, 24, 28}) {
+        vector<vector<int>> board(n, vector<int>(n, 0));
+        vector<int> columns;
+        double t_board = seconds([&] { solveNQueens(board, 0, n); });
+        double t_bits = seconds([&] { solve_n_queens(n, columns); });
+        cout << "  N = " << n << ": matriz " << setprecision(4) << t_board << " s, bits "
+             << t_bits << " s (" << setprecision(1) << t_board / t_bits << "x)" << endl;
+    }
+    return 0;
+}
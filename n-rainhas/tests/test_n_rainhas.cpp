@@ -0,0 +1,82 @@
+#include <iostream>
+#include <string>
+#include "n_rainhas.h"
+#include "n_rainhas_simetria.h"
+#include "thread_pool.h"
+#include "teste.h"
+
+// Número de soluções para N = 1..14 (OEIS A000170)
+const std::uint64_t KNOWN_SOLUTIONS[] = {
+    1, 0, 0, 2, 10, 4, 40, 92, 352, 724, 2680, 14200, 73712, 365596
+};
+
+// Soluções distintas a menos de rotação e espelhamento (OEIS A002562)
+const std::uint64_t KNOWN_UNIQUE[] = {
+    1, 0, 0, 1, 2, 1, 6, 12, 46, 92, 341, 1787, 9233, 45752
+};
+
+// Calculado pelo compilador: falha a compilação se a busca constexpr errar
+static_assert(CompileTimeNQueens<8>::value.total == 92 && CompileTimeNQueens<8>::value.unique == 12,
+              "N-Rainhas em tempo de compilação para N = 8");
+
+bool valid_solution(const std::vector<int>& columns) {
+    int n = static_cast<int>(columns.size());
+    for (int i = 0; i < n; ++i) {
+        for (int j = i + 1; j < n; ++j) {
+            if (columns[i] == columns[j] || j - i == columns[j] - columns[i] ||
+                j - i == columns[i] - columns[j]) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+int main() {
+    std::cout << "TESTES DAS N-RAINHAS COM TABULEIRO EM BITS" << std::endl;
+    std::cout << std::string(60, '=') << std::endl;
+
+    ThreadPool pool(4);
+    bool sequential_ok = true, parallel_ok = true;
+    for (int n = 1; n <= 14; ++n) {
+        NQueensCount sequential = count_n_queens(n);
+        sequential_ok = sequential_ok && sequential.solutions == KNOWN_SOLUTIONS[n - 1];
+
+        for (int depth = 1; depth <= 3; ++depth) {
+            NQueensCount parallel = count_n_queens_parallel(n, pool, depth);
+            parallel_ok = parallel_ok && parallel.solutions == sequential.solutions &&
+                          parallel.nodes == sequential.nodes;
+        }
+    }
+    check(sequential_ok, "contagem sequencial para N = 1..14");
+    check(parallel_ok, "contagem paralela (profundidades 1..3) igual à sequencial, inclusive nós");
+
+    bool symmetric_ok = true, fewer_nodes = true;
+    for (int n = 1; n <= 14; ++n) {
+        NQueensSymmetryCount symmetric = count_n_queens_symmetric(n);
+        symmetric_ok = symmetric_ok && symmetric.total == KNOWN_SOLUTIONS[n - 1] &&
+                       symmetric.unique == KNOWN_UNIQUE[n - 1];
+        if (n >= 4) fewer_nodes = fewer_nodes && symmetric.nodes < count_n_queens(n).nodes;
+    }
+    check(symmetric_ok, "busca com simetria: totais e únicas para N = 1..14");
+    check(fewer_nodes, "busca com simetria visita menos nós que a completa");
+
+    bool table_ok = true;
+    for (int n = 1; n <= COMPILE_TIME_MAX_N; ++n) {
+        NQueensSymmetryCount counts = n_queens_counts(n);
+        table_ok = table_ok && counts.total == KNOWN_SOLUTIONS[n - 1] &&
+                   counts.unique == KNOWN_UNIQUE[n - 1];
+    }
+    check(table_ok, "tabela de tempo de compilação para N = 1.." + std::to_string(COMPILE_TIME_MAX_N));
+    check(n_queens_counts(13).unique == 9233, "N acima da tabela cai na busca com simetria");
+
+    std::vector<int> columns;
+    check(solve_n_queens(8, columns) && valid_solution(columns) &&
+          columns == std::vector<int>({0, 4, 7, 5, 2, 6, 1, 3}),
+          "primeira solução para N = 8 é a mesma de N-Queens.cpp");
+    check(!solve_n_queens(3, columns), "N = 3 não tem solução");
+    check(solve_n_queens(32, columns) && valid_solution(columns), "solução válida para N = 32");
+
+    std::cout << std::string(60, '=') << std::endl;
+    return test_summary();
+}
@@ -0,0 +1,37 @@
+#include <chrono>
+#include <iostream>
+#include <string>
+#include "n_rainhas_busca_local.h"
+#include "teste.h"
+
+int main() {
+    std::cout << "TESTES DAS N-RAINHAS POR BUSCA LOCAL" << std::endl;
+    std::cout << std::string(60, '=') << std::endl;
+
+    std::vector<std::uint32_t> columns;
+    check(!solve_n_queens_min_conflicts(2, columns) && !solve_n_queens_min_conflicts(3, columns),
+          "N = 2 e N = 3 não têm solução");
+
+    bool small_ok = true;
+    for (std::uint32_t n = 4; n <= 200; ++n) {
+        small_ok = small_ok && solve_n_queens_min_conflicts(n, columns, n) && verify_n_queens(columns);
+    }
+    check(small_ok, "soluções válidas para N = 4..200");
+
+    check(!verify_n_queens({0, 1, 2, 3}), "verificação rejeita rainhas na mesma diagonal");
+    check(!verify_n_queens({1, 3, 0, 0}), "verificação rejeita coluna repetida");
+    check(verify_n_queens({1, 3, 0, 2}), "verificação aceita solução de N = 4");
+
+    MinConflictsStats stats;
+    std::uint32_t n = 10000000;
+    auto start = std::chrono::steady_clock::now();
+    bool solved = solve_n_queens_min_conflicts(n, columns, 7, &stats);
+    double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    check(solved && columns.size() == n && verify_n_queens(columns),
+          "solução verificada para N = 10^7 em " + std::to_string(elapsed) + " s (" +
+          std::to_string(stats.initial_conflicts) + " conflitos iniciais, " +
+          std::to_string(stats.swaps) + " trocas)");
+
+    std::cout << std::string(60, '=') << std::endl;
+    return test_summary();
+}
@@ -0,0 +1,51 @@
+#ifndef ESTATISTICAS_ORDENACAO_H
+#define ESTATISTICAS_ORDENACAO_H
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+
+/**
+ * Políticas de estatística para as ordenações
+ *
+ * Objetivo:
+ *   Substituir os contadores que bubbleSortDebug (bubble-sort.cpp)
+ *   mantém à mão por um parâmetro de template. Os algoritmos chamam
+ *   stats.on_compare() a cada comparação e stats.on_swap() a cada troca
+ *   (ou deslocamento de um elemento, o equivalente a uma troca vizinha
+ *   do bubble sort). Com NoStats as chamadas são vazias e o compilador
+ *   as elimina: a versão sem contagem não paga nada.
+ *
+ *   As ordenações adaptativas (power_sort) também chamam
+ *   stats.on_run(tamanho) para cada run natural encontrado na entrada.
+ */
+
+struct NoStats {
+    void on_compare() {}
+    void on_swap() {}
+    void on_run(std::size_t) {}
+};
+
+struct CountingStats {
+    std::uint64_t comparisons = 0;
+    std::uint64_t swaps = 0;
+    std::uint64_t runs = 0;
+    std::uint64_t longest_run = 0;
+
+    void on_compare() { ++comparisons; }
+    void on_swap() { ++swaps; }
+    void on_run(std::size_t length) {
+        ++runs;
+        if (length > longest_run) longest_run = length;
+    }
+
+    void print_results(std::ostream& out = std::cout) const {
+        out << "Total de comparações: " << comparisons << std::endl;
+        out << "Total de trocas: " << swaps << std::endl;
+        if (runs > 0) {
+            out << "Runs naturais: " << runs << " (maior com " << longest_run << " elementos)" << std::endl;
+        }
+    }
+};
+
+#endif
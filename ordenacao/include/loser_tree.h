@@ -0,0 +1,82 @@
+#ifndef LOSER_TREE_H
+#define LOSER_TREE_H
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+/**
+ * Árvore de perdedores para intercalação de k sequências
+ *
+ * Objetivo:
+ *   Escolher repetidamente o menor entre os elementos correntes de k
+ *   fontes ordenadas. Cada nó interno guarda o perdedor da disputa
+ *   naquele ponto; trocar o elemento da fonte vencedora só refaz o
+ *   caminho da folha até a raiz, com uma comparação por nível (um heap
+ *   binário faz duas). A árvore guarda ponteiros para os elementos
+ *   correntes, então quem a usa decide onde eles moram (um vetor em
+ *   memória, um buffer de leitura de arquivo...). nullptr marca uma
+ *   fonte esgotada. Empates vão para a fonte de menor índice, o que
+ *   deixa a intercalação estável.
+ *
+ * Complexidade:
+ *   - build: O(k)
+ *   - replace_winner: O(log k)
+ */
+
+template <typename T, typename Compare>
+class LoserTree {
+public:
+    LoserTree(std::size_t num_sources, Compare comp) : comp(comp) {
+        leaves = 1;
+        while (leaves < num_sources) leaves *= 2;
+        current.assign(leaves, nullptr);
+        tree.assign(leaves, 0);
+    }
+
+    // Elemento corrente da fonte i (nullptr = esgotada); chamar build() depois
+    void set_source(std::size_t i, const T* value) { current[i] = value; }
+
+    void build() { tree[0] = init(1); }
+
+    bool empty() const { return current[tree[0]] == nullptr; }
+    std::size_t winner() const { return tree[0]; }
+    const T& top() const { return *current[tree[0]]; }
+
+    // Novo elemento corrente da fonte vencedora
+    void replace_winner(const T* value) {
+        std::size_t winner = tree[0];
+        current[winner] = value;
+        for (std::size_t node = (winner + leaves) / 2; node >= 1; node /= 2) {
+            if (less(tree[node], winner)) std::swap(tree[node], winner);
+        }
+        tree[0] = winner;
+    }
+
+private:
+    Compare comp;
+    std::size_t leaves;
+    std::vector<const T*> current;
+    std::vector<std::size_t> tree;  // tree[0] = vencedor, demais = perdedores
+
+    bool less(std::size_t a, std::size_t b) const {
+        if (current[a] == nullptr) return false;
+        if (current[b] == nullptr) return true;
+        // Empate fica com a menor fonte (estável) numa só chamada a comp
+        return a < b ? !comp(*current[b], *current[a]) : comp(*current[a], *current[b]);
+    }
+
+    std::size_t init(std::size_t node) {
+        if (node >= leaves) return node - leaves;
+        std::size_t left = init(2 * node);
+        std::size_t right = init(2 * node + 1);
+        if (less(right, left)) {
+            tree[node] = left;
+            return right;
+        }
+        tree[node] = right;
+        return left;
+    }
+};
+
+#endif
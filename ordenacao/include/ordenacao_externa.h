@@ -0,0 +1,66 @@
+#ifndef ORDENACAO_EXTERNA_H
+#define ORDENACAO_EXTERNA_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+
+/**
+ * Ordenação externa de arquivos de registros de tamanho fixo
+ *
+ * Objetivo:
+ *   Ordenar arquivos binários maiores que a memória disponível. O
+ *   arquivo é uma sequência de registros de record_size bytes e a
+ *   ordem vem de uma chave de 64 bits extraída de cada registro.
+ *     1. Geração de runs: lê blocos que cabem em memory_budget, extrai
+ *        as chaves, ordena pares (chave, índice) com radix sort e grava
+ *        os registros na nova ordem. Tudo com leituras e escritas
+ *        sequenciais de io_block_size bytes.
+ *     2. Intercalação: uma árvore de perdedores escolhe o menor entre
+ *        os registros correntes de k runs. Cada run tem dois buffers: o
+ *        próximo bloco é lido em segundo plano (std::async) enquanto o
+ *        atual é consumido, e a saída também grava um buffer enquanto o
+ *        outro enche. Se houver mais runs do que cabem com blocos de
+ *        tamanho razoável, faz passadas intermediárias.
+ *   Empates preservam a ordem de entrada (ordenação estável).
+ *
+ *   Com 2 GB de memória e blocos mínimos de 1 MB, uma passada de
+ *   intercalação aceita ~1000 runs de ~2 GB: um arquivo de 20 GB (~10
+ *   runs) é lido e escrito duas vezes no total.
+ *
+ *   Os arquivos temporários ficam em temp_dir e são removidos logo após
+ *   abertos, então não sobram se o processo morrer.
+ *
+ * Complexidade:
+ *   - Tempo: O(n log n) de CPU; 2 * (1 + passadas) leituras/escritas do
+ *     arquivo, passadas = ceil(log_k(runs)) - 1
+ *   - Memória: memory_budget
+ */
+
+// Chave de ordenação de um registro (ordem crescente de uint64)
+using KeyExtractor = std::function<std::uint64_t(const unsigned char* record)>;
+
+// Inteiro sem sinal little-endian de width bytes (1 a 8) a partir de offset
+KeyExtractor unsigned_key_at(std::size_t offset, std::size_t width);
+
+struct ExternalSortConfig {
+    std::size_t record_size = 0;
+    KeyExtractor key;
+    std::size_t memory_budget = std::size_t(256) << 20;
+    std::size_t io_block_size = std::size_t(8) << 20;
+    std::string temp_dir = ".";
+};
+
+struct ExternalSortStats {
+    std::uint64_t records = 0;
+    std::size_t runs = 0;
+    int merge_passes = 0;  // inclui a final
+    double run_seconds = 0.0;
+    double merge_seconds = 0.0;
+};
+
+ExternalSortStats external_sort(const std::string& input_path, const std::string& output_path,
+                                const ExternalSortConfig& config);
+
+#endif
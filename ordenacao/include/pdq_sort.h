@@ -0,0 +1,390 @@
+#ifndef PDQ_SORT_H
+#define PDQ_SORT_H
+
+#include "estatisticas_ordenacao.h"
+#include "redes_ordenacao.h"
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * Pattern-defeating quicksort (pdqsort)
+ *
+ * Objetivo:
+ *   Ordenação genérica sobre iteradores de acesso aleatório e
+ *   comparadores, no lugar do bubbleSortDebug de bubble-sort.cpp.
+ *   É um introsort com as melhorias de Orson Peters:
+ *     - partições com menos de 24 elementos vão para insertion sort
+ *       (sem checagem de limite fora da partição mais à esquerda, pois o
+ *       pivô anterior serve de sentinela);
+ *     - pivô pela mediana de 3, ou pseudomediana de 9 acima de 128;
+ *     - se o pivô é igual ao da partição anterior, todos os iguais vão
+ *       para a esquerda de uma vez (entrada com muitas repetições vira
+ *       O(n));
+ *     - partição que não precisou de troca tenta um insertion sort
+ *       limitado: entrada já ordenada vira O(n);
+ *     - partição muito desbalanceada embaralha alguns elementos para
+ *       quebrar padrões e, após log2(n) delas, cai para heapsort.
+ *
+ *   O parâmetro Stats (NoStats, CountingStats) conta comparações e
+ *   trocas sem custo quando desligado.
+ *
+ *   Com AVX2, vetores contíguos de int32/float/int64 ordenados por
+ *   std::less e sem contagem usam as redes de redes_ordenacao.h para
+ *   partições de até 64 elementos e a partição vetorizada nas maiores.
+ *
+ * Complexidade:
+ *   - Tempo: O(n log n) no pior caso, O(n) para ordenada ou com poucos
+ *     valores distintos
+ *   - Espaço: O(log n) de pilha
+ */
+
+namespace sort_detail {
+
+const std::ptrdiff_t INSERTION_SORT_THRESHOLD = 24;
+const std::ptrdiff_t NINTHER_THRESHOLD = 128;
+const std::ptrdiff_t PARTIAL_INSERTION_SORT_LIMIT = 8;
+// Abaixo disso a partição vetorizada não compensa o preparo
+const std::ptrdiff_t VECTOR_PARTITION_THRESHOLD = 256;
+
+// Comparador que avisa a política a cada chamada
+template <typename Compare, typename Stats>
+struct CountingCompare {
+    Compare& comp;
+    Stats& stats;
+
+    template <typename A, typename B>
+    bool operator()(const A& a, const B& b) const {
+        stats.on_compare();
+        return comp(a, b);
+    }
+};
+
+template <typename It, typename Compare>
+struct SimdEligible : std::false_type {};
+
+// Iterador contíguo sobre int32/float/int64, std::less e NoStats
+template <typename It, typename Compare>
+struct SimdEligible<It, CountingCompare<Compare, NoStats>> {
+    using T = typename std::iterator_traits<It>::value_type;
+    static const bool value =
+        SIMD_SORT_AVAILABLE && IsNetworkType<T>::value &&
+        (std::is_same<It, T*>::value || std::is_same<It, typename std::vector<T>::iterator>::value) &&
+        (std::is_same<Compare, std::less<T>>::value || std::is_same<Compare, std::less<>>::value);
+};
+
+template <typename It, typename Stats>
+inline void swap_elements(It a, It b, Stats& stats) {
+    stats.on_swap();
+    std::iter_swap(a, b);
+}
+
+template <typename It, typename Compare, typename Stats>
+void insertion_sort(It begin, It end, Compare& comp, Stats& stats) {
+    using T = typename std::iterator_traits<It>::value_type;
+    if (begin == end) return;
+    for (It cur = begin + 1; cur != end; ++cur) {
+        It sift = cur;
+        It sift_1 = cur - 1;
+        if (comp(*sift, *sift_1)) {
+            T tmp = std::move(*sift);
+            do {
+                *sift-- = std::move(*sift_1);
+                stats.on_swap();
+            } while (sift != begin && comp(tmp, *--sift_1));
+            *sift = std::move(tmp);
+        }
+    }
+}
+
+// Exige que *(begin - 1) não seja maior que nenhum elemento de [begin, end)
+template <typename It, typename Compare, typename Stats>
+void unguarded_insertion_sort(It begin, It end, Compare& comp, Stats& stats) {
+    using T = typename std::iterator_traits<It>::value_type;
+    if (begin == end) return;
+    for (It cur = begin + 1; cur != end; ++cur) {
+        It sift = cur;
+        It sift_1 = cur - 1;
+        if (comp(*sift, *sift_1)) {
+            T tmp = std::move(*sift);
+            do {
+                *sift-- = std::move(*sift_1);
+                stats.on_swap();
+            } while (comp(tmp, *--sift_1));
+            *sift = std::move(tmp);
+        }
+    }
+}
+
+// Insertion sort que desiste após PARTIAL_INSERTION_SORT_LIMIT deslocamentos
+template <typename It, typename Compare, typename Stats>
+bool partial_insertion_sort(It begin, It end, Compare& comp, Stats& stats) {
+    using T = typename std::iterator_traits<It>::value_type;
+    if (begin == end) return true;
+    std::ptrdiff_t moved = 0;
+    for (It cur = begin + 1; cur != end; ++cur) {
+        It sift = cur;
+        It sift_1 = cur - 1;
+        if (comp(*sift, *sift_1)) {
+            T tmp = std::move(*sift);
+            do {
+                *sift-- = std::move(*sift_1);
+                stats.on_swap();
+            } while (sift != begin && comp(tmp, *--sift_1));
+            *sift = std::move(tmp);
+            moved += cur - sift;
+        }
+        if (moved > PARTIAL_INSERTION_SORT_LIMIT) return false;
+    }
+    return true;
+}
+
+template <typename It, typename Compare, typename Stats>
+void sift_down(It begin, std::ptrdiff_t root, std::ptrdiff_t size, Compare& comp, Stats& stats) {
+    while (true) {
+        std::ptrdiff_t child = 2 * root + 1;
+        if (child >= size) return;
+        if (child + 1 < size && comp(begin[child], begin[child + 1])) ++child;
+        if (!comp(begin[root], begin[child])) return;
+        swap_elements(begin + root, begin + child, stats);
+        root = child;
+    }
+}
+
+template <typename It, typename Compare, typename Stats>
+void heap_sort(It begin, It end, Compare& comp, Stats& stats) {
+    std::ptrdiff_t size = end - begin;
+    for (std::ptrdiff_t i = size / 2; i-- > 0;) sift_down(begin, i, size, comp, stats);
+    for (std::ptrdiff_t last = size - 1; last > 0; --last) {
+        swap_elements(begin, begin + last, stats);
+        sift_down(begin, 0, last, comp, stats);
+    }
+}
+
+template <typename It, typename Compare, typename Stats>
+inline void sort2(It a, It b, Compare& comp, Stats& stats) {
+    if (comp(*b, *a)) swap_elements(a, b, stats);
+}
+
+template <typename It, typename Compare, typename Stats>
+inline void sort3(It a, It b, It c, Compare& comp, Stats& stats) {
+    sort2(a, b, comp, stats);
+    sort2(b, c, comp, stats);
+    sort2(a, b, comp, stats);
+}
+
+// Pivô em *begin; iguais ao pivô ficam à direita. Devolve a posição
+// final do pivô e se a faixa já estava particionada.
+template <typename It, typename Compare, typename Stats>
+std::pair<It, bool> partition_right(It begin, It end, Compare& comp, Stats& stats) {
+    using T = typename std::iterator_traits<It>::value_type;
+    T pivot(std::move(*begin));
+    It first = begin;
+    It last = end;
+
+    // A mediana de 3 garante um elemento >= pivô à direita: sem checar limite
+    while (comp(*++first, pivot)) {}
+    if (first - 1 == begin) {
+        while (first < last && !comp(*--last, pivot)) {}
+    } else {
+        while (!comp(*--last, pivot)) {}
+    }
+
+    bool already_partitioned = first >= last;
+    while (first < last) {
+        swap_elements(first, last, stats);
+        while (comp(*++first, pivot)) {}
+        while (!comp(*--last, pivot)) {}
+    }
+
+    It pivot_pos = first - 1;
+    *begin = std::move(*pivot_pos);
+    *pivot_pos = std::move(pivot);
+    return std::make_pair(pivot_pos, already_partitioned);
+}
+
+// Mesmo contrato de partition_right, com a partição vetorizada no meio
+template <typename It>
+std::pair<It, bool> partition_right_vector(It begin, It end) {
+    using T = typename std::iterator_traits<It>::value_type;
+    T pivot = *begin;
+    It first = begin + 1;
+    It last = end;
+    while (first < last && *first < pivot) ++first;
+    while (first < last && !(last[-1] < pivot)) --last;
+    bool already_partitioned = first == last;
+    if (!already_partitioned) {
+        first += static_cast<std::ptrdiff_t>(vector_partition(&*first, static_cast<std::size_t>(last - first), pivot));
+    }
+    It pivot_pos = first - 1;
+    *begin = *pivot_pos;
+    *pivot_pos = pivot;
+    return std::make_pair(pivot_pos, already_partitioned);
+}
+
+// Iguais ao pivô ficam à esquerda; usado quando o pivô é igual ao
+// elemento que antecede a faixa, ou seja, a faixa toda é >= pivô
+template <typename It, typename Compare, typename Stats>
+It partition_left(It begin, It end, Compare& comp, Stats& stats) {
+    using T = typename std::iterator_traits<It>::value_type;
+    T pivot(std::move(*begin));
+    It first = begin;
+    It last = end;
+
+    while (comp(pivot, *--last)) {}
+    if (last + 1 == end) {
+        while (first < last && !comp(pivot, *++first)) {}
+    } else {
+        while (!comp(pivot, *++first)) {}
+    }
+
+    while (first < last) {
+        swap_elements(first, last, stats);
+        while (comp(pivot, *--last)) {}
+        while (!comp(pivot, *++first)) {}
+    }
+
+    It pivot_pos = last;
+    *begin = std::move(*pivot_pos);
+    *pivot_pos = std::move(pivot);
+    return pivot_pos;
+}
+
+// Embaralha posições fixas de uma partição desbalanceada
+template <typename It, typename Stats>
+void break_patterns(It begin, It end, Stats& stats) {
+    std::ptrdiff_t size = end - begin;
+    if (size < INSERTION_SORT_THRESHOLD) return;
+    std::ptrdiff_t quarter = size / 4;
+    swap_elements(begin, begin + quarter, stats);
+    swap_elements(end - 1, end - quarter, stats);
+    if (size > NINTHER_THRESHOLD) {
+        swap_elements(begin + 1, begin + (quarter + 1), stats);
+        swap_elements(begin + 2, begin + (quarter + 2), stats);
+        swap_elements(end - 2, end - (quarter + 1), stats);
+        swap_elements(end - 3, end - (quarter + 2), stats);
+    }
+}
+
+inline int log2_floor(std::size_t n) {
+    int log = 0;
+    while (n >>= 1) ++log;
+    return log;
+}
+
+template <typename It, typename Compare, typename Stats>
+void pdq_sort_loop(It begin, It end, Compare& comp, Stats& stats, int bad_allowed, bool leftmost) {
+    constexpr bool simd = SimdEligible<It, Compare>::value;
+    while (true) {
+        std::ptrdiff_t size = end - begin;
+        if constexpr (simd) {
+            if (size <= static_cast<std::ptrdiff_t>(NETWORK_MAX_SIZE)) {
+                network_sort(&*begin, static_cast<std::size_t>(size));
+                return;
+            }
+        }
+        if (size < INSERTION_SORT_THRESHOLD) {
+            if (leftmost) {
+                sort_detail::insertion_sort(begin, end, comp, stats);
+            } else {
+                unguarded_insertion_sort(begin, end, comp, stats);
+            }
+            return;
+        }
+
+        // Pivô vai para *begin
+        std::ptrdiff_t half = size / 2;
+        if (size > NINTHER_THRESHOLD) {
+            sort3(begin, begin + half, end - 1, comp, stats);
+            sort3(begin + 1, begin + (half - 1), end - 2, comp, stats);
+            sort3(begin + 2, begin + (half + 1), end - 3, comp, stats);
+            sort3(begin + (half - 1), begin + half, begin + (half + 1), comp, stats);
+            swap_elements(begin, begin + half, stats);
+        } else {
+            sort3(begin + half, begin, end - 1, comp, stats);
+        }
+
+        // Pivô igual ao antecessor: nenhum elemento é menor que ele
+        if (!leftmost && !comp(*(begin - 1), *begin)) {
+            begin = partition_left(begin, end, comp, stats) + 1;
+            continue;
+        }
+
+        std::pair<It, bool> part;
+        if constexpr (simd) {
+            part = size >= VECTOR_PARTITION_THRESHOLD ? partition_right_vector(begin, end)
+                                                      : partition_right(begin, end, comp, stats);
+        } else {
+            part = partition_right(begin, end, comp, stats);
+        }
+        It pivot_pos = part.first;
+        std::ptrdiff_t left_size = pivot_pos - begin;
+        std::ptrdiff_t right_size = end - (pivot_pos + 1);
+
+        if (left_size < size / 8 || right_size < size / 8) {
+            if (--bad_allowed == 0) {
+                sort_detail::heap_sort(begin, end, comp, stats);
+                return;
+            }
+            break_patterns(begin, pivot_pos, stats);
+            break_patterns(pivot_pos + 1, end, stats);
+        } else if (part.second && partial_insertion_sort(begin, pivot_pos, comp, stats) &&
+                   partial_insertion_sort(pivot_pos + 1, end, comp, stats)) {
+            return;
+        }
+
+        pdq_sort_loop(begin, pivot_pos, comp, stats, bad_allowed, leftmost);
+        begin = pivot_pos + 1;
+        leftmost = false;
+    }
+}
+
+}
+
+template <typename It, typename Compare, typename Stats>
+void pdq_sort(It first, It last, Compare comp, Stats& stats) {
+    if (last - first < 2) return;
+    sort_detail::CountingCompare<Compare, Stats> counted{comp, stats};
+    sort_detail::pdq_sort_loop(first, last, counted, stats,
+                               sort_detail::log2_floor(static_cast<std::size_t>(last - first)), true);
+}
+
+template <typename It, typename Compare>
+void pdq_sort(It first, It last, Compare comp) {
+    NoStats stats;
+    pdq_sort(first, last, comp, stats);
+}
+
+template <typename It>
+void pdq_sort(It first, It last) {
+    pdq_sort(first, last, std::less<typename std::iterator_traits<It>::value_type>());
+}
+
+template <typename It, typename Compare, typename Stats>
+void insertion_sort(It first, It last, Compare comp, Stats& stats) {
+    sort_detail::CountingCompare<Compare, Stats> counted{comp, stats};
+    sort_detail::insertion_sort(first, last, counted, stats);
+}
+
+template <typename It, typename Compare = std::less<typename std::iterator_traits<It>::value_type>>
+void insertion_sort(It first, It last, Compare comp = Compare()) {
+    NoStats stats;
+    insertion_sort(first, last, comp, stats);
+}
+
+template <typename It, typename Compare, typename Stats>
+void heap_sort(It first, It last, Compare comp, Stats& stats) {
+    sort_detail::CountingCompare<Compare, Stats> counted{comp, stats};
+    sort_detail::heap_sort(first, last, counted, stats);
+}
+
+template <typename It, typename Compare = std::less<typename std::iterator_traits<It>::value_type>>
+void heap_sort(It first, It last, Compare comp = Compare()) {
+    NoStats stats;
+    heap_sort(first, last, comp, stats);
+}
+
+#endif
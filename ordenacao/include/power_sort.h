@@ -0,0 +1,296 @@
+#ifndef POWER_SORT_H
+#define POWER_SORT_H
+
+#include "estatisticas_ordenacao.h"
+#include "pdq_sort.h"
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+/**
+ * Powersort: ordenação estável adaptativa a runs
+ *
+ * Objetivo:
+ *   Aproveitar entradas quase ordenadas (timestamps anexados, fluxos
+ *   já intercalados). bubbleSortDebug só para cedo quando uma passada
+ *   não troca nada; aqui a entrada é lida como uma sequência de runs
+ *   naturais:
+ *     - run crescente (não decrescente) é usado como está; run
+ *       estritamente decrescente é invertido (estrito para manter a
+ *       estabilidade);
+ *     - runs menores que MIN_RUN são estendidos com insertion sort;
+ *     - a ordem das intercalações segue a política do powersort
+ *       (Munro e Wild): cada fronteira entre runs recebe uma "potência"
+ *       pela posição dos pontos médios dos dois runs, e a pilha é
+ *       intercalada enquanto o topo tiver potência maior que a nova.
+ *       Isso dá intercalações quase ótimas sem as regras ad hoc do
+ *       TimSort;
+ *     - a intercalação copia só o run menor para o buffer, descarta
+ *       com galope (busca exponencial) os prefixos e sufixos que já
+ *       estão no lugar e entra em modo galope quando um lado vence
+ *       MIN_GALLOP vezes seguidas.
+ *
+ *   Estatísticas: stats.on_run(tamanho) para cada run natural,
+ *   on_compare para comparações e on_swap para cada elemento movido.
+ *
+ * Complexidade:
+ *   - Tempo: O(n) para entrada ordenada ou invertida; O(n + n H) em
+ *     geral, H = entropia dos tamanhos dos runs (no máximo O(n log n))
+ *   - Espaço: O(n / 2) de buffer
+ */
+
+namespace sort_detail {
+
+const std::ptrdiff_t MIN_RUN = 24;
+const std::ptrdiff_t MIN_GALLOP = 7;
+
+// Insertion sort de [begin, end) sabendo que [begin, sorted) já está ordenado
+template <typename It, typename Compare, typename Stats>
+void insertion_sort_from(It begin, It sorted, It end, Compare& comp, Stats& stats) {
+    using T = typename std::iterator_traits<It>::value_type;
+    for (It cur = sorted; cur != end; ++cur) {
+        It sift = cur;
+        if (sift == begin || !comp(*sift, *(sift - 1))) continue;
+        T tmp = std::move(*sift);
+        do {
+            *sift = std::move(*(sift - 1));
+            --sift;
+            stats.on_swap();
+        } while (sift != begin && comp(tmp, *(sift - 1)));
+        *sift = std::move(tmp);
+    }
+}
+
+// Fim do run natural que começa em begin (invertendo se for decrescente)
+template <typename It, typename Compare, typename Stats>
+It natural_run(It begin, It end, Compare& comp, Stats& stats) {
+    It run_end = begin + 1;
+    if (run_end == end) return run_end;
+    if (comp(*run_end, *begin)) {
+        while (++run_end != end && comp(*run_end, *(run_end - 1))) {}
+        for (It lo = begin, hi = run_end - 1; lo < hi; ++lo, --hi) swap_elements(lo, hi, stats);
+    } else {
+        while (++run_end != end && !comp(*run_end, *(run_end - 1))) {}
+    }
+    return run_end;
+}
+
+// Quantos elementos de [first, last) são < key (Strict) ou <= key
+template <bool Strict, typename It, typename T, typename Compare>
+std::ptrdiff_t gallop(It first, It last, const T& key, Compare& comp) {
+    auto before_key = [&](const T& x) { return Strict ? comp(x, key) : !comp(key, x); };
+    std::ptrdiff_t size = last - first;
+    std::ptrdiff_t lo = 0, hi = 1;
+    while (hi <= size && before_key(first[hi - 1])) {
+        lo = hi;
+        hi = 2 * hi + 1;
+    }
+    hi = std::min(hi, size + 1);
+    // Primeiro índice em [lo, hi - 1] que não vem antes de key
+    std::ptrdiff_t count = hi - 1 - lo;
+    It base = first + lo;
+    while (count > 0) {
+        std::ptrdiff_t step = count / 2;
+        if (before_key(base[step])) {
+            base += step + 1;
+            count -= step + 1;
+        } else {
+            count = step;
+        }
+    }
+    return base - first;
+}
+
+template <typename It, typename Compare, typename Stats>
+class RunMerger {
+public:
+    using T = typename std::iterator_traits<It>::value_type;
+
+    RunMerger(Compare& comp, Stats& stats) : comp(comp), stats(stats) {}
+
+    // Intercala [begin, middle) e [middle, end), ambos ordenados
+    void merge(It begin, It middle, It end) {
+        // Prefixo de A menor ou igual a B[0] e sufixo de B maior que A[último] já estão no lugar
+        begin += gallop<false>(begin, middle, *middle, comp);
+        if (begin == middle) return;
+        end = middle + gallop<true>(middle, end, *(middle - 1), comp);
+        if (middle - begin <= end - middle) {
+            merge_low(begin, middle, end);
+        } else {
+            merge_high(begin, middle, end);
+        }
+    }
+
+private:
+    Compare& comp;
+    Stats& stats;
+    std::vector<T> buffer;
+    std::ptrdiff_t min_gallop = MIN_GALLOP;
+
+    void move_out(T& from, T& to) {
+        to = std::move(from);
+        stats.on_swap();
+    }
+
+    // A (menor) vai para o buffer; intercala da esquerda para a direita
+    void merge_low(It begin, It middle, It end) {
+        buffer.assign(std::make_move_iterator(begin), std::make_move_iterator(middle));
+        auto a = buffer.begin(), a_end = buffer.end();
+        It b = middle, out = begin;
+
+        while (a != a_end && b != end) {
+            std::ptrdiff_t a_wins = 0, b_wins = 0;
+            while (a != a_end && b != end && a_wins < min_gallop && b_wins < min_gallop) {
+                if (comp(*b, *a)) {
+                    move_out(*b++, *out++);
+                    ++b_wins;
+                    a_wins = 0;
+                } else {
+                    move_out(*a++, *out++);
+                    ++a_wins;
+                    b_wins = 0;
+                }
+            }
+            // Galope: copia blocos inteiros enquanto compensar
+            while (a != a_end && b != end) {
+                std::ptrdiff_t from_a = gallop<false>(a, a_end, *b, comp);
+                for (std::ptrdiff_t k = 0; k < from_a; ++k) move_out(*a++, *out++);
+                if (a == a_end) break;
+                std::ptrdiff_t from_b = gallop<true>(b, end, *a, comp);
+                for (std::ptrdiff_t k = 0; k < from_b; ++k) move_out(*b++, *out++);
+                if (from_a < MIN_GALLOP && from_b < MIN_GALLOP) {
+                    ++min_gallop;
+                    break;
+                }
+                if (min_gallop > 1) --min_gallop;
+            }
+        }
+        while (a != a_end) move_out(*a++, *out++);
+    }
+
+    // B (menor) vai para o buffer; intercala da direita para a esquerda
+    void merge_high(It begin, It middle, It end) {
+        buffer.assign(std::make_move_iterator(middle), std::make_move_iterator(end));
+        auto b = buffer.end(), b_begin = buffer.begin();
+        It a = middle, out = end;
+
+        while (a != begin && b != b_begin) {
+            std::ptrdiff_t a_wins = 0, b_wins = 0;
+            while (a != begin && b != b_begin && a_wins < min_gallop && b_wins < min_gallop) {
+                if (comp(*(b - 1), *(a - 1))) {
+                    move_out(*--a, *--out);
+                    ++a_wins;
+                    b_wins = 0;
+                } else {
+                    move_out(*--b, *--out);
+                    ++b_wins;
+                    a_wins = 0;
+                }
+            }
+            while (a != begin && b != b_begin) {
+                // Elementos de B maiores ou iguais ao último de A
+                std::ptrdiff_t from_b = (b - b_begin) - gallop<true>(b_begin, b, *(a - 1), comp);
+                for (std::ptrdiff_t k = 0; k < from_b; ++k) move_out(*--b, *--out);
+                if (b == b_begin) break;
+                // Elementos de A estritamente maiores que o último de B
+                std::ptrdiff_t from_a = (a - begin) - gallop<false>(begin, a, *(b - 1), comp);
+                for (std::ptrdiff_t k = 0; k < from_a; ++k) move_out(*--a, *--out);
+                if (from_a < MIN_GALLOP && from_b < MIN_GALLOP) {
+                    ++min_gallop;
+                    break;
+                }
+                if (min_gallop > 1) --min_gallop;
+            }
+        }
+        while (b != b_begin) move_out(*--b, *--out);
+    }
+};
+
+// Potência da fronteira entre [begin_a, begin_b) e [begin_b, end_b) em [0, n)
+inline unsigned node_power(std::size_t n, std::size_t begin_a, std::size_t begin_b, std::size_t end_b) {
+    // Pontos médios (dobrados) em ponto fixo relativo a 2n
+    std::size_t left = begin_a + begin_b;
+    std::size_t right = begin_b + end_b;
+    std::size_t scale = 2 * n;
+    unsigned power = 0;
+    while (true) {
+        ++power;
+        left *= 2;
+        right *= 2;
+        bool left_bit = left >= scale, right_bit = right >= scale;
+        if (left_bit != right_bit) return power;
+        if (left_bit) {
+            left -= scale;
+            right -= scale;
+        }
+    }
+}
+
+template <typename It, typename Compare, typename Stats>
+void power_sort_impl(It first, It last, Compare& comp, Stats& stats) {
+    std::size_t n = static_cast<std::size_t>(last - first);
+    if (n < 2) return;
+
+    auto next_run = [&](It begin) {
+        It natural_end = natural_run(begin, last, comp, stats);
+        stats.on_run(static_cast<std::size_t>(natural_end - begin));
+        It run_end = natural_end;
+        if (run_end - begin < MIN_RUN) {
+            run_end = begin + std::min<std::ptrdiff_t>(MIN_RUN, last - begin);
+            insertion_sort_from(begin, natural_end, run_end, comp, stats);
+        }
+        return run_end;
+    };
+
+    struct PendingRun {
+        It begin;
+        unsigned power;  // da fronteira com o run seguinte
+    };
+    std::vector<PendingRun> stack;
+    RunMerger<It, Compare, Stats> merger(comp, stats);
+
+    It a_begin = first;
+    It a_end = next_run(first);
+    while (a_end != last) {
+        It b_end = next_run(a_end);
+        unsigned power = node_power(n, static_cast<std::size_t>(a_begin - first),
+                                    static_cast<std::size_t>(a_end - first), static_cast<std::size_t>(b_end - first));
+        while (!stack.empty() && stack.back().power > power) {
+            merger.merge(stack.back().begin, a_begin, a_end);
+            a_begin = stack.back().begin;
+            stack.pop_back();
+        }
+        stack.push_back({a_begin, power});
+        a_begin = a_end;
+        a_end = b_end;
+    }
+    while (!stack.empty()) {
+        merger.merge(stack.back().begin, a_begin, last);
+        a_begin = stack.back().begin;
+        stack.pop_back();
+    }
+}
+
+}
+
+template <typename It, typename Compare, typename Stats>
+void power_sort(It first, It last, Compare comp, Stats& stats) {
+    sort_detail::CountingCompare<Compare, Stats> counted{comp, stats};
+    sort_detail::power_sort_impl(first, last, counted, stats);
+}
+
+template <typename It, typename Compare>
+void power_sort(It first, It last, Compare comp) {
+    NoStats stats;
+    power_sort(first, last, comp, stats);
+}
+
+template <typename It>
+void power_sort(It first, It last) {
+    power_sort(first, last, std::less<typename std::iterator_traits<It>::value_type>());
+}
+
+#endif
@@ -0,0 +1,169 @@
+#ifndef RADIX_SORT_H
+#define RADIX_SORT_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <numeric>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * Radix sort LSD para chaves inteiras e de ponto flutuante
+ *
+ * Objetivo:
+ *   Ordenar dezenas de milhões de inteiros de 32/64 bits e floats sem
+ *   comparações. Cada passada distribui os elementos pelo dígito de
+ *   DigitBits bits (8 ou 11) da vez, do menos para o mais significativo;
+ *   por ser estável, a ordem das passadas anteriores se preserva.
+ *     - Uma única leitura inicial calcula os histogramas de todas as
+ *       passadas.
+ *     - Passada em que todos os elementos têm o mesmo dígito (o
+ *       histograma tem um balde com n) é pulada: chaves pequenas em
+ *       tipos largos custam só as passadas dos dígitos usados.
+ *     - Chaves com sinal e floats são levadas a inteiros sem sinal com a
+ *       mesma ordem: com sinal, inverte-se o bit de sinal; float positivo
+ *       inverte o bit de sinal e negativo inverte todos os bits. NaNs
+ *       ficam nas pontas (negativos antes de tudo, positivos depois) e
+ *       -0.0 antes de +0.0.
+ *
+ *   radix_sort_pairs leva valores junto com as chaves e radix_argsort
+ *   devolve a permutação estável que ordena as chaves.
+ *
+ * Complexidade:
+ *   - Tempo: O(p * (n + 2^DigitBits)), p = passadas não puladas
+ *   - Espaço: O(n) de buffer + O(p * 2^DigitBits) de histogramas
+ */
+
+namespace sort_detail {
+
+template <typename Key, typename Enable = void>
+struct RadixKey;
+
+template <typename Key>
+struct RadixKey<Key, typename std::enable_if<std::is_integral<Key>::value &&
+                                             std::is_unsigned<Key>::value>::type> {
+    using Bits = Key;
+    static Bits encode(Key key) { return key; }
+};
+
+template <typename Key>
+struct RadixKey<Key, typename std::enable_if<std::is_integral<Key>::value &&
+                                             std::is_signed<Key>::value>::type> {
+    using Bits = typename std::make_unsigned<Key>::type;
+    static Bits encode(Key key) {
+        return static_cast<Bits>(key) ^ (Bits(1) << (sizeof(Bits) * 8 - 1));
+    }
+};
+
+template <typename Key>
+struct RadixKey<Key, typename std::enable_if<std::is_floating_point<Key>::value>::type> {
+    static_assert(sizeof(Key) == 4 || sizeof(Key) == 8, "radix sort: float ou double");
+    using Bits = typename std::conditional<sizeof(Key) == 4, std::uint32_t, std::uint64_t>::type;
+    static Bits encode(Key key) {
+        Bits bits;
+        std::memcpy(&bits, &key, sizeof(bits));
+        const Bits sign = Bits(1) << (sizeof(Bits) * 8 - 1);
+        Bits mask = (bits & sign) ? ~Bits(0) : sign;
+        return bits ^ mask;
+    }
+};
+
+// Marca a ausência de valores em lsd_radix_sort
+struct NoValues {};
+
+template <unsigned DigitBits, typename Key, typename Value>
+void lsd_radix_sort(Key* keys, Key* key_buffer, Value* values, Value* value_buffer, std::size_t n) {
+    static_assert(DigitBits >= 1 && DigitBits <= 16, "radix sort: dígitos de 1 a 16 bits");
+    using Traits = RadixKey<Key>;
+    using Bits = typename Traits::Bits;
+    constexpr bool has_values = !std::is_same<Value, NoValues>::value;
+    constexpr unsigned key_bits = sizeof(Bits) * 8;
+    constexpr unsigned passes = (key_bits + DigitBits - 1) / DigitBits;
+    constexpr std::size_t radix = std::size_t(1) << DigitBits;
+    constexpr Bits mask = static_cast<Bits>(radix - 1);
+    if (n < 2) return;
+
+    // Histogramas de todas as passadas numa leitura só
+    std::vector<std::size_t> counts(passes * radix, 0);
+    for (std::size_t i = 0; i < n; ++i) {
+        Bits bits = Traits::encode(keys[i]);
+        for (unsigned p = 0; p < passes; ++p) {
+            ++counts[p * radix + ((bits >> (p * DigitBits)) & mask)];
+        }
+    }
+
+    Key* src = keys;
+    Key* dst = key_buffer;
+    Value* src_values = values;
+    Value* dst_values = value_buffer;
+    for (unsigned p = 0; p < passes; ++p) {
+        std::size_t* count = counts.data() + p * radix;
+        const unsigned shift = p * DigitBits;
+
+        // Dígito constante: a passada não mudaria nada
+        if (count[(Traits::encode(src[0]) >> shift) & mask] == n) continue;
+
+        std::size_t offset = 0;
+        for (std::size_t d = 0; d < radix; ++d) {
+            std::size_t c = count[d];
+            count[d] = offset;
+            offset += c;
+        }
+        for (std::size_t i = 0; i < n; ++i) {
+            std::size_t pos = count[(Traits::encode(src[i]) >> shift) & mask]++;
+            dst[pos] = std::move(src[i]);
+            if constexpr (has_values) dst_values[pos] = std::move(src_values[i]);
+        }
+        std::swap(src, dst);
+        if constexpr (has_values) std::swap(src_values, dst_values);
+    }
+
+    // Número ímpar de passadas: o resultado está no buffer
+    if (src != keys) {
+        std::move(src, src + n, keys);
+        if constexpr (has_values) std::move(src_values, src_values + n, values);
+    }
+}
+
+}
+
+// buffer deve ter espaço para n chaves
+template <unsigned DigitBits = 8, typename Key>
+void radix_sort(Key* keys, std::size_t n, Key* buffer) {
+    sort_detail::NoValues* none = nullptr;
+    sort_detail::lsd_radix_sort<DigitBits>(keys, buffer, none, none, n);
+}
+
+template <unsigned DigitBits = 8, typename Key>
+void radix_sort(std::vector<Key>& keys) {
+    std::vector<Key> buffer(keys.size());
+    radix_sort<DigitBits>(keys.data(), keys.size(), buffer.data());
+}
+
+// Ordena keys e aplica a mesma permutação (estável) em values
+template <unsigned DigitBits = 8, typename Key, typename Value>
+void radix_sort_pairs(std::vector<Key>& keys, std::vector<Value>& values) {
+    if (keys.size() != values.size()) {
+        throw std::invalid_argument("radix_sort_pairs: chaves e valores com tamanhos diferentes");
+    }
+    std::vector<Key> key_buffer(keys.size());
+    std::vector<Value> value_buffer(values.size());
+    sort_detail::lsd_radix_sort<DigitBits>(keys.data(), key_buffer.data(), values.data(),
+                                           value_buffer.data(), keys.size());
+}
+
+// Índices que ordenam keys (estável); keys não é alterado
+template <unsigned DigitBits = 8, typename Key>
+std::vector<std::uint32_t> radix_argsort(const std::vector<Key>& keys) {
+    std::vector<Key> sorted_keys(keys);
+    std::vector<std::uint32_t> order(keys.size());
+    std::iota(order.begin(), order.end(), 0u);
+    radix_sort_pairs<DigitBits>(sorted_keys, order);
+    return order;
+}
+
+#endif
@@ -0,0 +1,348 @@
+#ifndef REDES_ORDENACAO_H
+#define REDES_ORDENACAO_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+/**
+ * Redes de ordenação bitônicas e partição vetorizada
+ *
+ * Objetivo:
+ *   Ordenar blocos pequenos (8, 16, 32 ou 64 elementos de int32, float
+ *   ou int64) sem desvios dependentes dos dados. A rede bitônica faz
+ *   sempre a mesma sequência de log2(N) * (log2(N) + 1) / 2 estágios de
+ *   compara-e-troca; com AVX2 cada estágio é min/max sobre registradores
+ *   inteiros:
+ *     - parceiro em outro registrador (distância >= lanes): min e max
+ *       entre os dois registradores;
+ *     - parceiro no mesmo registrador: permuta as lanes, faz min/max e
+ *       escolhe por lane com blend.
+ *   Sem AVX2 (compilado sem -mavx2) a mesma rede roda escalar.
+ *
+ *   network_sort ordena qualquer n <= 64 preenchendo até a menor rede
+ *   que o comporta com o maior valor do tipo (+infinito em float).
+ *
+ *   vector_partition separa, no lugar, os elementos < pivô dos >= pivô
+ *   processando 8 (int32/float) ou 4 (int64) por vez: a comparação vira
+ *   uma máscara de bits, que indexa uma tabela de permutações que junta
+ *   os menores no início do registrador e os demais no fim; o registrador
+ *   é gravado inteiro nas duas pontas livres do vetor. Os dois primeiros
+ *   blocos são guardados antes, para sempre haver espaço livre.
+ *
+ *   pdq_sort usa as duas coisas quando o tipo é elegível, o comparador é
+ *   std::less e não há contagem (NoStats). NaNs em float não têm ordem
+ *   definida.
+ *
+ * Complexidade:
+ *   - Rede de N: O(N log^2 N) comparações, mas N / lanes por instrução
+ *   - Partição: O(n)
+ */
+
+template <typename T>
+struct IsNetworkType
+    : std::integral_constant<bool, std::is_same<T, std::int32_t>::value || std::is_same<T, float>::value ||
+                                       std::is_same<T, std::int64_t>::value> {};
+
+#ifdef __AVX2__
+const bool SIMD_SORT_AVAILABLE = true;
+#else
+const bool SIMD_SORT_AVAILABLE = false;
+#endif
+
+const std::size_t NETWORK_MAX_SIZE = 64;
+
+namespace sort_detail {
+
+template <typename T, int N>
+void scalar_bitonic(T* data) {
+    for (int k = 2; k <= N; k *= 2) {
+        for (int j = k / 2; j > 0; j /= 2) {
+            for (int i = 0; i < N; ++i) {
+                int partner = i ^ j;
+                if (partner < i) continue;
+                bool descending = (i & k) != 0;
+                T a = data[i], b = data[partner];
+                T low = b < a ? b : a;
+                T high = b < a ? a : b;
+                data[i] = descending ? high : low;
+                data[partner] = descending ? low : high;
+            }
+        }
+    }
+}
+
+#ifdef __AVX2__
+
+template <typename T>
+struct Avx2Ops;
+
+template <>
+struct Avx2Ops<std::int32_t> {
+    using V = __m256i;
+    static const int lanes = 8;
+    static V load(const std::int32_t* p) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+    static void store(std::int32_t* p, V v) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v); }
+    static V set1(std::int32_t x) { return _mm256_set1_epi32(x); }
+    static V min(V a, V b) { return _mm256_min_epi32(a, b); }
+    static V max(V a, V b) { return _mm256_max_epi32(a, b); }
+    static V permute(V v, __m256i index) { return _mm256_permutevar8x32_epi32(v, index); }
+    static V blend(V a, V b, __m256i mask) { return _mm256_blendv_epi8(a, b, mask); }
+    static int less_mask(V v, V pivot) { return _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(pivot, v))); }
+};
+
+template <>
+struct Avx2Ops<float> {
+    using V = __m256;
+    static const int lanes = 8;
+    static V load(const float* p) { return _mm256_loadu_ps(p); }
+    static void store(float* p, V v) { _mm256_storeu_ps(p, v); }
+    static V set1(float x) { return _mm256_set1_ps(x); }
+    static V min(V a, V b) { return _mm256_min_ps(a, b); }
+    static V max(V a, V b) { return _mm256_max_ps(a, b); }
+    static V permute(V v, __m256i index) { return _mm256_permutevar8x32_ps(v, index); }
+    static V blend(V a, V b, __m256i mask) { return _mm256_blendv_ps(a, b, _mm256_castsi256_ps(mask)); }
+    static int less_mask(V v, V pivot) { return _mm256_movemask_ps(_mm256_cmp_ps(v, pivot, _CMP_LT_OQ)); }
+};
+
+template <>
+struct Avx2Ops<std::int64_t> {
+    using V = __m256i;
+    static const int lanes = 4;
+    static V load(const std::int64_t* p) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+    static void store(std::int64_t* p, V v) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v); }
+    static V set1(std::int64_t x) { return _mm256_set1_epi64x(x); }
+    static V min(V a, V b) { return _mm256_blendv_epi8(a, b, _mm256_cmpgt_epi64(a, b)); }
+    static V max(V a, V b) { return _mm256_blendv_epi8(b, a, _mm256_cmpgt_epi64(a, b)); }
+    // Índices em dwords: cada int64 ocupa duas lanes de 32 bits
+    static V permute(V v, __m256i index) { return _mm256_permutevar8x32_epi32(v, index); }
+    static V blend(V a, V b, __m256i mask) { return _mm256_blendv_epi8(a, b, mask); }
+    static int less_mask(V v, V pivot) { return _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(pivot, v))); }
+};
+
+// Vetor de 8 dwords com f(d) na lane d, calculado em tempo de compilação
+template <typename F, std::size_t... D>
+inline __m256i dword_vector(F f, std::index_sequence<D...>) {
+    return _mm256_setr_epi32(f(D)...);
+}
+
+template <int Lanes, typename F>
+inline __m256i dword_vector(F f) {
+    return dword_vector([f](std::size_t d) { return f(static_cast<int>(d) * Lanes / 8, static_cast<int>(d)); },
+                        std::make_index_sequence<8>());
+}
+
+template <typename T, int N>
+struct BitonicNetwork {
+    using Ops = Avx2Ops<T>;
+    using V = typename Ops::V;
+    static const int L = Ops::lanes;
+    static const int R = N / L;
+
+    static void sort(T* data) {
+        V v[R];
+        for (int r = 0; r < R; ++r) v[r] = Ops::load(data + r * L);
+        stages<2>(v);
+        for (int r = 0; r < R; ++r) Ops::store(data + r * L, v[r]);
+    }
+
+    template <int K>
+    static void stages(V* v) {
+        if constexpr (K <= N) {
+            steps<K, K / 2>(v);
+            stages<K * 2>(v);
+        }
+    }
+
+    template <int K, int J>
+    static void steps(V* v) {
+        if constexpr (J > 0) {
+            step<K, J>(v);
+            steps<K, J / 2>(v);
+        }
+    }
+
+    // Lane l compara com l ^ J; fica com o máximo se (l & J) xor (l & K)
+    template <int K, int J>
+    static void step(V* v) {
+        if constexpr (J >= L) {
+            const int reg_distance = J / L;
+            for (int r = 0; r < R; ++r) {
+                if (r & reg_distance) continue;
+                int p = r | reg_distance;
+                bool descending = ((r * L) & K) != 0;
+                V low = Ops::min(v[r], v[p]);
+                V high = Ops::max(v[r], v[p]);
+                v[r] = descending ? high : low;
+                v[p] = descending ? low : high;
+            }
+        } else {
+            const __m256i index = dword_vector<L>([](int e, int d) { return (e ^ J) * (8 / L) + d % (8 / L); });
+            if constexpr (K < L) {
+                const __m256i mask = dword_vector<L>([](int e, int) { return ((e & J) != 0) != ((e & K) != 0) ? -1 : 0; });
+                for (int r = 0; r < R; ++r) {
+                    V partner = Ops::permute(v[r], index);
+                    v[r] = Ops::blend(Ops::min(v[r], partner), Ops::max(v[r], partner), mask);
+                }
+            } else {
+                const __m256i upper = dword_vector<L>([](int e, int) { return (e & J) != 0 ? -1 : 0; });
+                for (int r = 0; r < R; ++r) {
+                    V partner = Ops::permute(v[r], index);
+                    V low = Ops::min(v[r], partner);
+                    V high = Ops::max(v[r], partner);
+                    bool descending = ((r * L) & K) != 0;
+                    v[r] = descending ? Ops::blend(high, low, upper) : Ops::blend(low, high, upper);
+                }
+            }
+        }
+    }
+};
+
+// Tabela de permutações: para cada máscara de "menores", as lanes
+// menores primeiro e as demais depois, mantendo a ordem relativa
+template <int Lanes>
+struct CompressTable {
+    alignas(32) std::int32_t index[1 << Lanes][8];
+
+    CompressTable() {
+        const int width = 8 / Lanes;  // dwords por elemento
+        for (int mask = 0; mask < (1 << Lanes); ++mask) {
+            int out = 0;
+            for (int pass = 0; pass < 2; ++pass) {
+                for (int e = 0; e < Lanes; ++e) {
+                    bool is_less = (mask >> e) & 1;
+                    if (is_less != (pass == 0)) continue;
+                    for (int w = 0; w < width; ++w) index[mask][out * width + w] = e * width + w;
+                    ++out;
+                }
+            }
+        }
+    }
+};
+
+template <int Lanes>
+const CompressTable<Lanes>& compress_table() {
+    static const CompressTable<Lanes> table;
+    return table;
+}
+
+template <typename T>
+std::size_t avx2_partition(T* data, std::size_t n, T pivot) {
+    using Ops = Avx2Ops<T>;
+    using V = typename Ops::V;
+    const int L = Ops::lanes;
+    const CompressTable<L>& table = compress_table<L>();
+
+    T* store_left = data;
+    T* store_right = data + n;
+    auto place = [&](T x) {
+        if (x < pivot) {
+            *store_left++ = x;
+        } else {
+            *--store_right = x;
+        }
+    };
+    if (n < 2 * std::size_t(L)) {
+        T saved[2 * 8];
+        std::copy(data, data + n, saved);
+        for (std::size_t i = 0; i < n; ++i) place(saved[i]);
+        return static_cast<std::size_t>(store_left - data);
+    }
+
+    // Primeiro e último bloco ficam guardados: abrem espaço nas pontas
+    T saved[2 * 8];
+    std::copy(data, data + L, saved);
+    std::copy(data + n - L, data + n, saved + L);
+    T* left = data + L;
+    T* right = data + n - L;
+    const V pivots = Ops::set1(pivot);
+
+    while (right - left >= L) {
+        // Lê do lado com menos espaço livre: o outro sempre tem >= L
+        V v;
+        if (left - store_left <= store_right - right) {
+            v = Ops::load(left);
+            left += L;
+        } else {
+            right -= L;
+            v = Ops::load(right);
+        }
+        int mask = Ops::less_mask(v, pivots);
+        int less = __builtin_popcount(static_cast<unsigned>(mask));
+        __m256i index = _mm256_load_si256(reinterpret_cast<const __m256i*>(table.index[mask]));
+        V packed = Ops::permute(v, index);
+        Ops::store(store_left, packed);
+        Ops::store(store_right - L, packed);
+        store_left += less;
+        store_right -= L - less;
+    }
+
+    T tail[8];
+    std::size_t remaining = static_cast<std::size_t>(right - left);
+    std::copy(left, right, tail);
+    for (std::size_t i = 0; i < remaining; ++i) place(tail[i]);
+    for (int i = 0; i < 2 * L; ++i) place(saved[i]);
+    return static_cast<std::size_t>(store_left - data);
+}
+
+#endif
+
+template <typename T>
+T network_padding() {
+    return std::numeric_limits<T>::has_infinity ? std::numeric_limits<T>::infinity()
+                                                : std::numeric_limits<T>::max();
+}
+
+}
+
+// Ordena exatamente N elementos (N = 8, 16, 32 ou 64)
+template <std::size_t N, typename T>
+void sorting_network(T* data) {
+    static_assert(IsNetworkType<T>::value, "redes de ordenação: int32_t, float ou int64_t");
+    static_assert(N == 8 || N == 16 || N == 32 || N == 64, "redes de ordenação: N = 8, 16, 32 ou 64");
+#ifdef __AVX2__
+    sort_detail::BitonicNetwork<T, static_cast<int>(N)>::sort(data);
+#else
+    sort_detail::scalar_bitonic<T, static_cast<int>(N)>(data);
+#endif
+}
+
+// Ordena n <= NETWORK_MAX_SIZE elementos com a menor rede que os comporta
+template <typename T>
+void network_sort(T* data, std::size_t n) {
+    static_assert(IsNetworkType<T>::value, "redes de ordenação: int32_t, float ou int64_t");
+    if (n < 2) return;
+    std::size_t size = 8;
+    while (size < n) size *= 2;
+    alignas(32) T block[NETWORK_MAX_SIZE];
+    std::copy(data, data + n, block);
+    std::fill(block + n, block + size, sort_detail::network_padding<T>());
+    switch (size) {
+        case 8: sorting_network<8>(block); break;
+        case 16: sorting_network<16>(block); break;
+        case 32: sorting_network<32>(block); break;
+        default: sorting_network<64>(block); break;
+    }
+    std::copy(block, block + n, data);
+}
+
+// Reordena data para que [0, k) < pivô <= [k, n); devolve k
+template <typename T>
+std::size_t vector_partition(T* data, std::size_t n, T pivot) {
+    static_assert(IsNetworkType<T>::value, "partição vetorizada: int32_t, float ou int64_t");
+#ifdef __AVX2__
+    return sort_detail::avx2_partition(data, n, pivot);
+#else
+    T* middle = std::partition(data, data + n, [pivot](T x) { return x < pivot; });
+    return static_cast<std::size_t>(middle - data);
+#endif
+}
+
+#endif
@@ -0,0 +1,141 @@
+#ifndef SAMPLE_SORT_H
+#define SAMPLE_SORT_H
+
+#include "loser_tree.h"
+#include "pdq_sort.h"
+#include "thread_pool.h"
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <vector>
+
+/**
+ * Ordenação paralela por amostragem (sample sort / PSRS)
+ *
+ * Objetivo:
+ *   Ordenar vetores grandes usando todos os núcleos do ThreadPool
+ *   compartilhado (comum/include/thread_pool.h):
+ *     1. Divide a entrada em P blocos (P = threads) e ordena cada um
+ *        com pdq_sort em paralelo.
+ *     2. Tira OVERSAMPLING * P amostras regulares de cada bloco ordenado
+ *        e escolhe P - 1 separadores entre elas.
+ *     3. Busca binária acha, em cada bloco, a fatia de cada balde; a
+ *        soma das fatias dá a posição de saída de cada balde.
+ *     4. Cada balde intercala as suas P fatias com uma árvore de
+ *        perdedores, em paralelo, num buffer auxiliar, que depois volta
+ *        para a entrada com uma cópia paralela.
+ *   Abaixo de sequential_threshold elementos (ou com 1 thread) usa
+ *   pdq_sort direto: o custo de coordenar não compensaria.
+ *
+ *   As amostras regulares limitam cada balde a cerca de 2n/P elementos
+ *   com chaves distintas. Muitas chaves iguais a um separador caem no
+ *   mesmo balde, e a intercalação desse balde fica sequencial.
+ *
+ * Complexidade:
+ *   - Tempo: O((n log n) / P + n log P / P + P^2 log n)
+ *   - Espaço: O(n) de buffer
+ */
+
+const std::size_t PARALLEL_SORT_THRESHOLD = 1 << 17;
+
+namespace sort_detail {
+
+const std::size_t OVERSAMPLING = 8;
+
+}
+
+template <typename It, typename Compare>
+void sample_sort(ThreadPool& pool, It first, It last, Compare comp,
+                 std::size_t sequential_threshold = PARALLEL_SORT_THRESHOLD) {
+    using T = typename std::iterator_traits<It>::value_type;
+    std::size_t n = static_cast<std::size_t>(last - first);
+    std::size_t parts = pool.size();
+    if (n < std::max<std::size_t>(sequential_threshold, 2) || parts == 1) {
+        pdq_sort(first, last, comp);
+        return;
+    }
+    parts = std::min(parts, n);
+
+    auto chunk_begin = [&](std::size_t c) { return first + static_cast<std::ptrdiff_t>(c * n / parts); };
+
+    // 1. Blocos ordenados
+    {
+        TaskGroup group(pool);
+        for (std::size_t c = 0; c < parts; ++c) {
+            group.run([&, c] { pdq_sort(chunk_begin(c), chunk_begin(c + 1), comp); });
+        }
+        group.wait();
+    }
+
+    // 2. Separadores por amostragem regular
+    std::size_t per_chunk = sort_detail::OVERSAMPLING * parts;
+    std::vector<T> samples;
+    samples.reserve(per_chunk * parts);
+    for (std::size_t c = 0; c < parts; ++c) {
+        std::size_t size = static_cast<std::size_t>(chunk_begin(c + 1) - chunk_begin(c));
+        for (std::size_t s = 0; s < per_chunk && size > 0; ++s) {
+            samples.push_back(chunk_begin(c)[static_cast<std::ptrdiff_t>(s * size / per_chunk)]);
+        }
+    }
+    pdq_sort(samples.begin(), samples.end(), comp);
+    std::vector<T> splitters;
+    for (std::size_t b = 1; b < parts; ++b) splitters.push_back(samples[b * samples.size() / parts]);
+
+    // 3. Fatia de cada balde em cada bloco: bounds[c * (parts + 1) + b]
+    std::vector<It> bounds(parts * (parts + 1));
+    for (std::size_t c = 0; c < parts; ++c) {
+        It* row = &bounds[c * (parts + 1)];
+        row[0] = chunk_begin(c);
+        row[parts] = chunk_begin(c + 1);
+        for (std::size_t b = 1; b < parts; ++b) {
+            row[b] = std::upper_bound(row[b - 1], row[parts], splitters[b - 1], comp);
+        }
+    }
+    std::vector<std::size_t> output(parts + 1, 0);
+    for (std::size_t b = 0; b < parts; ++b) {
+        std::size_t size = 0;
+        for (std::size_t c = 0; c < parts; ++c) {
+            size += static_cast<std::size_t>(bounds[c * (parts + 1) + b + 1] - bounds[c * (parts + 1) + b]);
+        }
+        output[b + 1] = output[b] + size;
+    }
+
+    // 4. Intercalação de cada balde no buffer e cópia de volta
+    std::vector<T> buffer(n);
+    {
+        TaskGroup group(pool);
+        for (std::size_t b = 0; b < parts; ++b) {
+            group.run([&, b] {
+                std::vector<It> cursor(parts), end(parts);
+                LoserTree<T, Compare> tree(parts, comp);
+                for (std::size_t c = 0; c < parts; ++c) {
+                    cursor[c] = bounds[c * (parts + 1) + b];
+                    end[c] = bounds[c * (parts + 1) + b + 1];
+                    tree.set_source(c, cursor[c] == end[c] ? nullptr : &*cursor[c]);
+                }
+                tree.build();
+                T* out = buffer.data() + output[b];
+                while (!tree.empty()) {
+                    std::size_t c = tree.winner();
+                    *out++ = std::move(*cursor[c]);
+                    ++cursor[c];
+                    tree.replace_winner(cursor[c] == end[c] ? nullptr : &*cursor[c]);
+                }
+            });
+        }
+        group.wait();
+    }
+    parallel_for(pool, 0, n, (n + parts - 1) / parts, [&](std::size_t lo, std::size_t hi) {
+        std::move(buffer.begin() + static_cast<std::ptrdiff_t>(lo),
+                  buffer.begin() + static_cast<std::ptrdiff_t>(hi),
+                  first + static_cast<std::ptrdiff_t>(lo));
+    });
+}
+
+template <typename It>
+void sample_sort(ThreadPool& pool, It first, It last) {
+    sample_sort(pool, first, last, std::less<typename std::iterator_traits<It>::value_type>());
+}
+
+#endif
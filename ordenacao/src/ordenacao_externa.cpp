@@ -0,0 +1,329 @@
+#include "ordenacao_externa.h"
+#include "loser_tree.h"
+#include "radix_sort.h"
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <future>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+
+// Menor bloco de leitura por run na intercalação
+const std::size_t MIN_READ_BLOCK = std::size_t(1) << 20;
+// Memória por registro na geração de runs além do próprio registro:
+// chave e índice, mais os buffers do radix sort
+const std::size_t RUN_OVERHEAD_PER_RECORD = 2 * sizeof(std::uint64_t) + 2 * sizeof(std::uint32_t);
+
+class File {
+public:
+    File(const std::string& path, int flags, bool unlink_after_open = false) : path(path) {
+        fd = ::open(path.c_str(), flags, 0644);
+        if (fd < 0) throw std::runtime_error("Não foi possível abrir " + path);
+        if (unlink_after_open) ::unlink(path.c_str());
+    }
+    ~File() { ::close(fd); }
+
+    File(const File&) = delete;
+    File& operator=(const File&) = delete;
+
+    std::uint64_t size() const {
+        struct stat info;
+        if (::fstat(fd, &info) != 0) throw std::runtime_error("fstat falhou em " + path);
+        return static_cast<std::uint64_t>(info.st_size);
+    }
+
+    // Verdadeiro se other_path é este mesmo arquivo (outro nome ou link)
+    bool same_file(const std::string& other_path) const {
+        struct stat mine, other;
+        if (::fstat(fd, &mine) != 0) throw std::runtime_error("fstat falhou em " + path);
+        if (::stat(other_path.c_str(), &other) != 0) return false;
+        return mine.st_dev == other.st_dev && mine.st_ino == other.st_ino;
+    }
+
+    void read_at(unsigned char* data, std::size_t bytes, std::uint64_t offset) const {
+        while (bytes > 0) {
+            ssize_t got = ::pread(fd, data, bytes, static_cast<off_t>(offset));
+            if (got < 0 && errno == EINTR) continue;
+            if (got <= 0) throw std::runtime_error("Erro de leitura em " + path);
+            data += got;
+            bytes -= static_cast<std::size_t>(got);
+            offset += static_cast<std::uint64_t>(got);
+        }
+    }
+
+    void write_at(const unsigned char* data, std::size_t bytes, std::uint64_t offset) const {
+        while (bytes > 0) {
+            ssize_t put = ::pwrite(fd, data, bytes, static_cast<off_t>(offset));
+            if (put < 0 && errno == EINTR) continue;
+            if (put <= 0) throw std::runtime_error("Erro de escrita em " + path);
+            data += put;
+            bytes -= static_cast<std::size_t>(put);
+            offset += static_cast<std::uint64_t>(put);
+        }
+    }
+
+private:
+    std::string path;
+    int fd;
+};
+
+std::unique_ptr<File> temp_file(const std::string& dir) {
+    static std::atomic<unsigned> counter{0};
+    std::string path = dir + "/ordenacao_externa_" + std::to_string(::getpid()) + "_" +
+                       std::to_string(counter.fetch_add(1)) + ".tmp";
+    return std::unique_ptr<File>(new File(path, O_RDWR | O_CREAT | O_TRUNC, true));
+}
+
+// Escrita sequencial com dois buffers: um grava em segundo plano
+// enquanto o outro enche
+class BlockWriter {
+public:
+    BlockWriter(const File& file, std::uint64_t offset, std::size_t block_size)
+        : file(file), offset(offset), front(block_size), back(block_size) {}
+
+    ~BlockWriter() {
+        if (pending.valid()) pending.wait();
+    }
+
+    void append(const unsigned char* data, std::size_t bytes) {
+        if (filled + bytes > front.size()) flush();
+        std::memcpy(front.data() + filled, data, bytes);
+        filled += bytes;
+    }
+
+    // Grava o que falta e espera terminar; devolve o offset final
+    std::uint64_t finish() {
+        flush();
+        if (pending.valid()) pending.get();
+        return offset;
+    }
+
+private:
+    const File& file;
+    std::uint64_t offset;
+    std::vector<unsigned char> front, back;
+    std::size_t filled = 0;
+    std::future<void> pending;
+
+    void flush() {
+        if (filled == 0) return;
+        if (pending.valid()) pending.get();
+        std::swap(front, back);
+        const unsigned char* data = back.data();
+        std::size_t bytes = filled;
+        std::uint64_t at = offset;
+        pending = std::async(std::launch::async, [this, data, bytes, at] { file.write_at(data, bytes, at); });
+        offset += bytes;
+        filled = 0;
+    }
+};
+
+struct Run {
+    std::uint64_t offset;  // em bytes
+    std::uint64_t records;
+};
+
+// Leitura de um run com leitura antecipada do próximo bloco
+class RunReader {
+public:
+    RunReader(const File& file, const Run& run, std::size_t record_size, std::size_t block_size)
+        : file(file), record_size(record_size), next_offset(run.offset),
+          remaining(run.records * record_size), front(block_size), back(block_size) {
+        prefetch();
+        swap_buffers();
+    }
+
+    ~RunReader() {
+        if (pending.valid()) pending.wait();
+    }
+
+    const unsigned char* current() const { return position < available ? front.data() + position : nullptr; }
+
+    void advance() {
+        position += record_size;
+        if (position == available) swap_buffers();
+    }
+
+private:
+    const File& file;
+    std::size_t record_size;
+    std::uint64_t next_offset;
+    std::uint64_t remaining;  // bytes ainda não pedidos
+    std::vector<unsigned char> front, back;
+    std::size_t position = 0, available = 0, requested = 0;
+    std::future<void> pending;
+
+    void prefetch() {
+        requested = static_cast<std::size_t>(std::min<std::uint64_t>(back.size(), remaining));
+        if (requested == 0) return;
+        unsigned char* data = back.data();
+        std::size_t bytes = requested;
+        std::uint64_t at = next_offset;
+        pending = std::async(std::launch::async, [this, data, bytes, at] { file.read_at(data, bytes, at); });
+        next_offset += requested;
+        remaining -= requested;
+    }
+
+    void swap_buffers() {
+        if (pending.valid()) pending.get();
+        std::swap(front, back);
+        available = requested;
+        position = 0;
+        prefetch();
+    }
+};
+
+struct MergeHead {
+    std::uint64_t key;
+    const unsigned char* record;
+};
+
+struct HeadLess {
+    bool operator()(const MergeHead& a, const MergeHead& b) const { return a.key < b.key; }
+};
+
+void merge_runs(const File& in, const std::vector<Run>& runs, std::size_t first, std::size_t count,
+                const ExternalSortConfig& config, std::size_t read_block, BlockWriter& writer) {
+    std::vector<std::unique_ptr<RunReader>> readers;
+    std::vector<MergeHead> heads(count);
+    LoserTree<MergeHead, HeadLess> tree(count, HeadLess());
+    for (std::size_t i = 0; i < count; ++i) {
+        readers.emplace_back(new RunReader(in, runs[first + i], config.record_size, read_block));
+        const unsigned char* record = readers[i]->current();
+        if (record) heads[i] = {config.key(record), record};
+        tree.set_source(i, record ? &heads[i] : nullptr);
+    }
+    tree.build();
+
+    while (!tree.empty()) {
+        std::size_t i = tree.winner();
+        writer.append(heads[i].record, config.record_size);
+        readers[i]->advance();
+        const unsigned char* record = readers[i]->current();
+        if (record) heads[i] = {config.key(record), record};
+        tree.replace_winner(record ? &heads[i] : nullptr);
+    }
+}
+
+double elapsed_since(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+}
+
+KeyExtractor unsigned_key_at(std::size_t offset, std::size_t width) {
+    if (width < 1 || width > 8) throw std::invalid_argument("unsigned_key_at: largura de 1 a 8 bytes");
+    return [offset, width](const unsigned char* record) {
+        std::uint64_t key = 0;
+        for (std::size_t b = width; b-- > 0;) key = (key << 8) | record[offset + b];
+        return key;
+    };
+}
+
+ExternalSortStats external_sort(const std::string& input_path, const std::string& output_path,
+                                const ExternalSortConfig& config) {
+    if (config.record_size == 0) throw std::invalid_argument("Ordenação externa: record_size deve ser positivo");
+    if (!config.key) throw std::invalid_argument("Ordenação externa: falta o extrator de chave");
+
+    const std::size_t record_size = config.record_size;
+    // Blocos de E/S em múltiplos de registro e no máximo 1/8 da memória
+    std::size_t io_block = std::min(config.io_block_size, config.memory_budget / 8);
+    io_block = std::max(record_size, io_block / record_size * record_size);
+    std::size_t work_memory = config.memory_budget > 2 * io_block ? config.memory_budget - 2 * io_block : 0;
+
+    ExternalSortStats stats;
+    File input(input_path, O_RDONLY);
+    std::uint64_t input_bytes = input.size();
+    if (input_bytes % record_size != 0) {
+        throw std::runtime_error("Tamanho de " + input_path + " não é múltiplo do registro");
+    }
+    stats.records = input_bytes / record_size;
+    // O_TRUNC na saída apagaria a entrada antes da primeira leitura
+    if (input.same_file(output_path)) {
+        throw std::invalid_argument("Ordenação externa: entrada e saída são o mesmo arquivo: " + output_path);
+    }
+    File output(output_path, O_RDWR | O_CREAT | O_TRUNC);
+
+    // 1. Runs ordenados
+    auto start = std::chrono::steady_clock::now();
+    std::size_t capacity = std::max<std::size_t>(1, work_memory / (record_size + RUN_OVERHEAD_PER_RECORD));
+    capacity = std::min<std::size_t>(capacity, UINT32_MAX);
+    bool single_run = stats.records <= capacity;
+    std::unique_ptr<File> runs_file = single_run ? nullptr : temp_file(config.temp_dir);
+    const File& run_target = single_run ? output : *runs_file;
+
+    std::vector<Run> runs;
+    {
+        std::vector<unsigned char> records(std::min<std::uint64_t>(capacity, stats.records) * record_size);
+        std::vector<std::uint64_t> keys;
+        std::vector<std::uint32_t> order;
+        BlockWriter writer(run_target, 0, io_block);
+        std::uint64_t run_offset = 0;
+        for (std::uint64_t done = 0; done < stats.records;) {
+            std::size_t count = static_cast<std::size_t>(std::min<std::uint64_t>(capacity, stats.records - done));
+            input.read_at(records.data(), count * record_size, done * record_size);
+
+            keys.resize(count);
+            order.resize(count);
+            for (std::size_t i = 0; i < count; ++i) {
+                keys[i] = config.key(records.data() + i * record_size);
+                order[i] = static_cast<std::uint32_t>(i);
+            }
+            radix_sort_pairs(keys, order);
+            for (std::size_t i = 0; i < count; ++i) {
+                writer.append(records.data() + std::size_t(order[i]) * record_size, record_size);
+            }
+
+            runs.push_back({run_offset, count});
+            run_offset += std::uint64_t(count) * record_size;
+            done += count;
+        }
+        writer.finish();
+    }
+    stats.runs = runs.size();
+    stats.run_seconds = elapsed_since(start);
+    if (single_run) return stats;
+
+    // 2. Intercalação em passadas de até fan_in runs
+    start = std::chrono::steady_clock::now();
+    std::size_t min_block = std::max(record_size, std::min(MIN_READ_BLOCK, work_memory / 64) / record_size * record_size);
+    std::size_t fan_in = std::max<std::size_t>(2, work_memory / (2 * min_block));
+
+    std::unique_ptr<File> spare;
+    while (true) {
+        bool last_pass = runs.size() <= fan_in;
+        if (!last_pass && !spare) spare = temp_file(config.temp_dir);
+        const File& target = last_pass ? output : *spare;
+
+        std::size_t group = std::min(fan_in, runs.size());
+        std::size_t read_block = std::max(record_size, work_memory / (2 * group) / record_size * record_size);
+
+        std::vector<Run> merged;
+        BlockWriter writer(target, 0, io_block);
+        std::uint64_t offset = 0;
+        for (std::size_t first = 0; first < runs.size(); first += fan_in) {
+            std::size_t count = std::min(fan_in, runs.size() - first);
+            std::uint64_t records = 0;
+            for (std::size_t i = first; i < first + count; ++i) records += runs[i].records;
+            merge_runs(*runs_file, runs, first, count, config, read_block, writer);
+            merged.push_back({offset, records});
+            offset += records * record_size;
+        }
+        writer.finish();
+        ++stats.merge_passes;
+
+        if (last_pass) break;
+        runs.swap(merged);
+        std::swap(runs_file, spare);
+    }
+    stats.merge_seconds = elapsed_since(start);
+    return stats;
+}
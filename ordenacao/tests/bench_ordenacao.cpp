@@ -0,0 +1,90 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include "pdq_sort.h"
+#include "power_sort.h"
+#include "radix_sort.h"
+
+using namespace std;
+
+template <typename Fn>
+double seconds(Fn fn) {
+    auto start = chrono::steady_clock::now();
+    fn();
+    auto end = chrono::steady_clock::now();
+    return chrono::duration<double>(end - start).count();
+}
+
+// Melhor de algumas repetições, em milhões de elementos por segundo
+template <typename Key, typename Sort>
+double throughput(const vector<Key>& input, Sort sort) {
+    int repeats = input.size() >= 10000000 ? 1 : 3;
+    double best = 1e30;
+    for (int r = 0; r < repeats; ++r) {
+        vector<Key> data = input;
+        best = min(best, seconds([&] { sort(data); }));
+        if (!is_sorted(data.begin(), data.end())) cerr << "  [NÃO ORDENOU]" << endl;
+    }
+    return input.size() / best / 1e6;
+}
+
+template <typename Key, typename Generator>
+void bench_type(const string& name, size_t n_max, Generator generate) {
+    cout << "\n" << name << " (Melems/s)" << endl;
+    cout << setw(12) << "n" << setw(12) << "std::sort" << setw(12) << "pdq_sort"
+         << setw(12) << "radix 8" << setw(12) << "radix 11" << setw(12) << "argsort 8" << endl;
+    for (size_t n = 1000; n <= n_max; n *= 10) {
+        vector<Key> input(n);
+        for (Key& key : input) key = generate();
+        cout << setw(12) << n << fixed << setprecision(1)
+             << setw(12) << throughput(input, [](vector<Key>& v) { sort(v.begin(), v.end()); })
+             << setw(12) << throughput(input, [](vector<Key>& v) { pdq_sort(v.begin(), v.end()); })
+             << setw(12) << throughput(input, [](vector<Key>& v) { radix_sort<8>(v); })
+             << setw(12) << throughput(input, [](vector<Key>& v) { radix_sort<11>(v); });
+        double t_arg = seconds([&] { radix_argsort<8>(input); });
+        cout << setw(12) << n / t_arg / 1e6 << endl;
+    }
+}
+
+// Entradas quase ordenadas: onde o powersort deve ganhar
+void bench_adaptive(size_t n, mt19937_64& rng) {
+    cout << "\nQuase ordenado, n = " << n << " (Melems/s)" << endl;
+    cout << setw(24) << "entrada" << setw(12) << "std::sort" << setw(12) << "stable" << setw(12) << "pdq_sort"
+         << setw(12) << "power_sort" << endl;
+    vector<pair<string, vector<int64_t>>> inputs;
+    vector<int64_t> v(n);
+    for (size_t i = 0; i < n; ++i) v[i] = static_cast<int64_t>(i);
+    inputs.push_back({"ordenada", v});
+    for (size_t k = 0; k < n / 1000; ++k) v[rng() % n] -= static_cast<int64_t>(rng() % 100);
+    inputs.push_back({"0,1% atrasados", v});
+    for (size_t i = 0; i < n; ++i) v[i] = static_cast<int64_t>(i % (n / 16)) * 16 + static_cast<int64_t>(i / (n / 16));
+    inputs.push_back({"16 fluxos concatenados", v});
+    for (auto& input : inputs) {
+        cout << setw(24) << input.first << fixed << setprecision(1)
+             << setw(12) << throughput(input.second, [](vector<int64_t>& d) { sort(d.begin(), d.end()); })
+             << setw(12) << throughput(input.second, [](vector<int64_t>& d) { stable_sort(d.begin(), d.end()); })
+             << setw(12) << throughput(input.second, [](vector<int64_t>& d) { pdq_sort(d.begin(), d.end()); })
+             << setw(12) << throughput(input.second, [](vector<int64_t>& d) { power_sort(d.begin(), d.end()); })
+             << endl;
+    }
+}
+
+int main(int argc, char** argv) {
+    size_t n_max = argc > 1 ? strtoull(argv[1], nullptr, 10) : 10000000;
+    mt19937_64 rng(42);
+    normal_distribution<double> normal(0.0, 1e6);
+
+    cout << "BENCHMARK DE ORDENAÇÃO: COMPARAÇÃO x RADIX" << endl;
+    cout << string(72, '=') << endl;
+    bench_type<uint32_t>("uint32", n_max, [&] { return static_cast<uint32_t>(rng()); });
+    bench_type<int64_t>("int64", n_max, [&] { return static_cast<int64_t>(rng()); });
+    bench_type<float>("float", n_max, [&] { return static_cast<float>(normal(rng)); });
+    bench_type<uint64_t>("uint64 < 2^20 (passadas puladas)", n_max, [&] { return rng() >> 44; });
+    bench_adaptive(n_max, rng);
+    return 0;
+}
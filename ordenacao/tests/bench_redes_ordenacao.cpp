@@ -0,0 +1,82 @@
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include "pdq_sort.h"
+#include "redes_ordenacao.h"
+
+using namespace std;
+
+template <typename Fn>
+double seconds(Fn fn) {
+    auto start = chrono::steady_clock::now();
+    fn();
+    auto end = chrono::steady_clock::now();
+    return chrono::duration<double>(end - start).count();
+}
+
+// Ordena muitos blocos de N elementos aleatórios; devolve ns por bloco
+template <typename T, size_t N, typename Sort>
+double ns_per_block(const vector<T>& input, Sort sort) {
+    vector<T> data = input;
+    size_t blocks = data.size() / N;
+    double t = seconds([&] {
+        for (size_t b = 0; b < blocks; ++b) sort(data.data() + b * N);
+    });
+    for (size_t b = 0; b < blocks; ++b) {
+        if (!is_sorted(data.begin() + b * N, data.begin() + (b + 1) * N)) cerr << "  [NÃO ORDENOU]" << endl;
+    }
+    return t / blocks * 1e9;
+}
+
+template <typename T, size_t N>
+void bench_size(const string& name, mt19937_64& rng) {
+    vector<T> input(N * 200000);
+    for (T& x : input) x = static_cast<T>(static_cast<int64_t>(rng() % 2000000) - 1000000);
+    cout << setw(8) << name << setw(6) << N << fixed << setprecision(1)
+         << setw(14) << ns_per_block<T, N>(input, [](T* p) { sorting_network<N>(p); })
+         << setw(16) << ns_per_block<T, N>(input, [](T* p) { insertion_sort(p, p + N); })
+         << setw(16) << ns_per_block<T, N>(input, [](T* p) { sort(p, p + N); }) << endl;
+}
+
+template <typename T>
+void bench_type(const string& name, mt19937_64& rng) {
+    bench_size<T, 8>(name, rng);
+    bench_size<T, 16>(name, rng);
+    bench_size<T, 32>(name, rng);
+    bench_size<T, 64>(name, rng);
+}
+
+template <typename T>
+void bench_partition(const string& name, mt19937_64& rng) {
+    vector<T> input(10000000);
+    for (T& x : input) x = static_cast<T>(static_cast<int64_t>(rng() % 2000000) - 1000000);
+    T pivot = 0;
+    vector<T> data = input;
+    double t_vector = seconds([&] { vector_partition(data.data(), data.size(), pivot); });
+    data = input;
+    double t_std = seconds([&] { std::partition(data.begin(), data.end(), [&](T x) { return x < pivot; }); });
+    cout << setw(8) << name << setw(16) << setprecision(1) << input.size() / t_vector / 1e6
+         << setw(16) << input.size() / t_std / 1e6 << endl;
+}
+
+int main() {
+    mt19937_64 rng(3);
+    cout << "BENCHMARK DAS REDES DE ORDENAÇÃO (" << (SIMD_SORT_AVAILABLE ? "AVX2" : "escalar") << ")" << endl;
+    cout << string(56, '=') << endl;
+    cout << setw(8) << "tipo" << setw(6) << "N" << setw(14) << "rede (ns)" << setw(16) << "inserção (ns)"
+         << setw(16) << "std::sort (ns)" << endl;
+    bench_type<int32_t>("int32", rng);
+    bench_type<float>("float", rng);
+    bench_type<int64_t>("int64", rng);
+
+    cout << "\nPartição de 10^7 elementos (Melems/s)" << endl;
+    cout << setw(8) << "tipo" << setw(16) << "vetorizada" << setw(16) << "std::partition" << endl;
+    bench_partition<int32_t>("int32", rng);
+    bench_partition<float>("float", rng);
+    bench_partition<int64_t>("int64", rng);
+    return 0;
+}
@@ -0,0 +1,53 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include "pdq_sort.h"
+#include "sample_sort.h"
+
+using namespace std;
+
+struct Record {
+    uint64_t key;
+    uint64_t payload[3];
+};
+
+template <typename Fn>
+double seconds(Fn fn) {
+    auto start = chrono::steady_clock::now();
+    fn();
+    auto end = chrono::steady_clock::now();
+    return chrono::duration<double>(end - start).count();
+}
+
+int main(int argc, char** argv) {
+    size_t n = argc > 1 ? strtoull(argv[1], nullptr, 10) : 20000000;
+    unsigned max_threads = argc > 2 ? atoi(argv[2]) : thread::hardware_concurrency();
+
+    mt19937_64 rng(7);
+    vector<Record> input(n);
+    for (Record& r : input) r.key = rng();
+    auto by_key = [](const Record& a, const Record& b) { return a.key < b.key; };
+
+    cout << "BENCHMARK DO SAMPLE SORT (" << n << " registros de " << sizeof(Record) << " bytes)" << endl;
+    cout << string(60, '=') << endl;
+
+    vector<Record> data = input;
+    double t_sequential = seconds([&] { pdq_sort(data.begin(), data.end(), by_key); });
+    cout << setw(10) << "threads" << setw(14) << "tempo (s)" << setw(14) << "speedup" << endl;
+    cout << setw(10) << "pdq" << setw(14) << fixed << setprecision(3) << t_sequential << setw(14) << 1.0 << endl;
+
+    for (unsigned threads = 1; threads <= max_threads; threads *= 2) {
+        ThreadPool pool(threads);
+        data = input;
+        double t = seconds([&] { sample_sort(pool, data.begin(), data.end(), by_key); });
+        cout << setw(10) << threads << setw(14) << t << setw(14) << setprecision(2) << t_sequential / t
+             << setprecision(3) << (is_sorted(data.begin(), data.end(), by_key) ? "" : "  [NÃO ORDENOU]")
+             << endl;
+    }
+    return 0;
+}
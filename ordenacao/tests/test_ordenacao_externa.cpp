@@ -0,0 +1,109 @@
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include "ordenacao_externa.h"
+#include "teste.h"
+
+// Registro de 24 bytes: chave de 4 bytes no offset 8, posição original no início
+struct Record {
+    std::uint64_t original;
+    std::uint32_t key;
+    unsigned char filler[12];
+};
+
+std::vector<Record> make_records(std::size_t n, std::uint32_t key_range, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::vector<Record> records(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        records[i].original = i;
+        records[i].key = static_cast<std::uint32_t>(rng() % key_range);
+        std::memset(records[i].filler, static_cast<int>(i & 0xFF), sizeof(records[i].filler));
+    }
+    return records;
+}
+
+void write_records(const std::string& path, const std::vector<Record>& records) {
+    std::ofstream out(path, std::ios::binary);
+    out.write(reinterpret_cast<const char*>(records.data()), records.size() * sizeof(Record));
+}
+
+std::vector<Record> read_records(const std::string& path) {
+    std::ifstream in(path, std::ios::binary | std::ios::ate);
+    std::vector<Record> records(static_cast<std::size_t>(in.tellg()) / sizeof(Record));
+    in.seekg(0);
+    in.read(reinterpret_cast<char*>(records.data()), records.size() * sizeof(Record));
+    return records;
+}
+
+// Ordenação estável por chave, com os registros intactos
+bool matches_stable_sort(std::vector<Record> input, const std::vector<Record>& output) {
+    std::stable_sort(input.begin(), input.end(), [](const Record& a, const Record& b) { return a.key < b.key; });
+    return input.size() == output.size() &&
+           std::equal(input.begin(), input.end(), output.begin(), [](const Record& a, const Record& b) {
+               return std::memcmp(&a, &b, sizeof(Record)) == 0;
+           });
+}
+
+int main() {
+    std::cout << "TESTES DA ORDENAÇÃO EXTERNA" << std::endl;
+    std::cout << std::string(60, '=') << std::endl;
+
+    const std::string input = "teste_externa_entrada.bin";
+    const std::string output = "teste_externa_saida.bin";
+    ExternalSortConfig config;
+    config.record_size = sizeof(Record);
+    config.key = unsigned_key_at(8, 4);
+
+    std::vector<Record> small = make_records(1000, 1u << 31, 1);
+    write_records(input, small);
+    ExternalSortStats stats = external_sort(input, output, config);
+    check(stats.runs == 1 && stats.merge_passes == 0 && matches_stable_sort(small, read_records(output)),
+          "arquivo que cabe na memória: um run, sem intercalação");
+
+    std::vector<Record> big = make_records(400000, 1000, 2);
+    write_records(input, big);
+    config.memory_budget = 4 << 20;
+    stats = external_sort(input, output, config);
+    check(stats.runs > 1 && stats.merge_passes == 1 && matches_stable_sort(big, read_records(output)),
+          "4 MB de memória: " + std::to_string(stats.runs) + " runs e uma intercalação estável");
+
+    config.memory_budget = 256 << 10;
+    config.io_block_size = 4 << 10;
+    stats = external_sort(input, output, config);
+    check(stats.merge_passes > 1 && matches_stable_sort(big, read_records(output)),
+          "256 KB de memória: " + std::to_string(stats.runs) + " runs em " +
+              std::to_string(stats.merge_passes) + " passadas");
+
+    write_records(input, {});
+    stats = external_sort(input, output, config);
+    check(stats.records == 0 && read_records(output).empty(), "arquivo vazio");
+
+    std::ofstream(input, std::ios::binary) << "abc";
+    bool threw = false;
+    try {
+        external_sort(input, output, config);
+    } catch (const std::runtime_error&) {
+        threw = true;
+    }
+    check(threw, "tamanho que não é múltiplo do registro lança runtime_error");
+
+    write_records(input, small);
+    threw = false;
+    try {
+        external_sort(input, input, config);
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    check(threw && read_records(input).size() == small.size(), "entrada igual à saída lança invalid_argument e não trunca a entrada");
+
+    std::remove(input.c_str());
+    std::remove(output.c_str());
+
+    std::cout << std::string(60, '=') << std::endl;
+    return test_summary();
+}
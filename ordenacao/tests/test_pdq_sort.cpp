@@ -0,0 +1,93 @@
+#include <algorithm>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include "pdq_sort.h"
+#include "teste.h"
+
+// Padrões clássicos que derrubam quicksorts ingênuos
+std::vector<std::vector<int>> patterns(std::size_t n, std::mt19937& rng) {
+    std::vector<std::vector<int>> all;
+    std::vector<int> v(n);
+
+    for (int& x : v) x = static_cast<int>(rng());
+    all.push_back(v);
+    for (int& x : v) x = static_cast<int>(rng() % 4);
+    all.push_back(v);
+    for (std::size_t i = 0; i < n; ++i) v[i] = static_cast<int>(i);
+    all.push_back(v);
+    std::reverse(v.begin(), v.end());
+    all.push_back(v);
+    for (std::size_t i = 0; i < n; ++i) v[i] = static_cast<int>(std::min(i, n - i));
+    all.push_back(v);
+    for (std::size_t i = 0; i < n; ++i) v[i] = static_cast<int>(i);
+    for (std::size_t k = 0; n > 0 && k < n / 100 + 1; ++k) std::swap(v[rng() % n], v[rng() % n]);
+    all.push_back(v);
+    std::fill(v.begin(), v.end(), 7);
+    all.push_back(v);
+    return all;
+}
+
+int main() {
+    std::cout << "TESTES DO PDQSORT" << std::endl;
+    std::cout << std::string(60, '=') << std::endl;
+
+    std::mt19937 rng(12345);
+    bool sorted_ok = true;
+    for (std::size_t n : {0, 1, 2, 5, 23, 24, 25, 127, 129, 1000, 100000}) {
+        for (std::vector<int>& v : patterns(n, rng)) {
+            std::vector<int> expected = v;
+            std::sort(expected.begin(), expected.end());
+            pdq_sort(v.begin(), v.end());
+            sorted_ok = sorted_ok && v == expected;
+        }
+    }
+    check(sorted_ok, "ordena aleatório, repetidos, crescente, decrescente, órgão, quase ordenado");
+
+    std::vector<int> descending = patterns(10000, rng)[0];
+    pdq_sort(descending.begin(), descending.end(), std::greater<int>());
+    check(std::is_sorted(descending.begin(), descending.end(), std::greater<int>()),
+          "comparador personalizado (decrescente)");
+
+    std::vector<std::string> words = {"pera", "uva", "abacaxi", "banana", "kiwi", "maçã", "figo"};
+    pdq_sort(words.begin(), words.end(),
+             [](const std::string& a, const std::string& b) { return a.size() < b.size(); });
+    check(std::is_sorted(words.begin(), words.end(),
+                         [](const std::string& a, const std::string& b) { return a.size() < b.size(); }),
+          "strings por tamanho");
+
+    int raw[] = {5, 3, 9, 1, 7};
+    pdq_sort(raw, raw + 5);
+    check(std::is_sorted(raw, raw + 5), "funciona com ponteiros");
+
+    // Estatísticas: mesmas que bubbleSortDebug imprime
+    std::vector<int> small = {5, 2, 9, 1, 5, 6};
+    CountingStats bubble_like;
+    insertion_sort(small.begin(), small.end(), std::less<int>(), bubble_like);
+    check(std::is_sorted(small.begin(), small.end()) && bubble_like.swaps == 6,
+          "insertion sort faz as mesmas 6 trocas que bubbleSortDebug no exemplo de bubble-sort.cpp");
+
+    std::size_t n = 100000;
+    std::vector<int> ascending(n);
+    for (std::size_t i = 0; i < n; ++i) ascending[i] = static_cast<int>(i);
+    CountingStats on_sorted;
+    pdq_sort(ascending.begin(), ascending.end(), std::less<int>(), on_sorted);
+    check(on_sorted.comparisons < 3 * n && on_sorted.swaps < n / 10,
+          "entrada ordenada custa O(n): " + std::to_string(on_sorted.comparisons) + " comparações");
+
+    std::vector<int> few(n);
+    for (int& x : few) x = static_cast<int>(rng() % 3);
+    CountingStats on_few;
+    pdq_sort(few.begin(), few.end(), std::less<int>(), on_few);
+    check(on_few.comparisons < 10 * n, "poucos valores distintos custam O(n): " +
+                                             std::to_string(on_few.comparisons) + " comparações");
+
+    std::vector<int> heap = patterns(5000, rng)[0];
+    heap_sort(heap.begin(), heap.end());
+    check(std::is_sorted(heap.begin(), heap.end()), "heapsort de reserva ordena");
+
+    std::cout << std::string(60, '=') << std::endl;
+    return test_summary();
+}
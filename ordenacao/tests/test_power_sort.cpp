@@ -0,0 +1,92 @@
+#include <algorithm>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "power_sort.h"
+#include "teste.h"
+
+struct Item {
+    int key;
+    int order;
+};
+
+bool key_less(const Item& a, const Item& b) { return a.key < b.key; }
+
+// Compara com std::stable_sort: mesma ordem inclusive entre chaves iguais
+bool stable_like_std(std::vector<Item> items) {
+    std::vector<Item> expected = items;
+    std::stable_sort(expected.begin(), expected.end(), key_less);
+    power_sort(items.begin(), items.end(), key_less);
+    for (std::size_t i = 0; i < items.size(); ++i) {
+        if (items[i].key != expected[i].key || items[i].order != expected[i].order) return false;
+    }
+    return true;
+}
+
+int main() {
+    std::cout << "TESTES DO POWERSORT" << std::endl;
+    std::cout << std::string(60, '=') << std::endl;
+
+    std::mt19937 rng(77);
+    bool ok = true;
+    for (std::size_t n : {0, 1, 2, 23, 24, 25, 100, 1000, 100000}) {
+        for (int range : {3, 100, 1 << 30}) {
+            std::vector<Item> items(n);
+            for (std::size_t i = 0; i < n; ++i) items[i] = {static_cast<int>(rng() % range), static_cast<int>(i)};
+            ok = ok && stable_like_std(items);
+
+            // Runs longos crescentes e decrescentes alternados
+            std::sort(items.begin(), items.end(), key_less);
+            for (std::size_t i = 0; i + 500 <= n; i += 1000) std::reverse(items.begin() + i, items.begin() + i + 500);
+            for (std::size_t i = 0; i < n; ++i) items[i].order = static_cast<int>(i);
+            ok = ok && stable_like_std(items);
+        }
+    }
+    check(ok, "estável e igual a std::stable_sort (aleatório, repetidos, runs alternados)");
+
+    std::size_t n = 1000000;
+    std::vector<int> sorted(n);
+    for (std::size_t i = 0; i < n; ++i) sorted[i] = static_cast<int>(i / 3);
+    CountingStats on_sorted;
+    power_sort(sorted.begin(), sorted.end(), std::less<int>(), on_sorted);
+    check(on_sorted.comparisons == n - 1 && on_sorted.swaps == 0 && on_sorted.runs == 1,
+          "entrada ordenada: n - 1 comparações, nenhuma troca, um run");
+
+    std::vector<int> reversed(n);
+    for (std::size_t i = 0; i < n; ++i) reversed[i] = static_cast<int>(n - i);
+    CountingStats on_reversed;
+    power_sort(reversed.begin(), reversed.end(), std::less<int>(), on_reversed);
+    check(std::is_sorted(reversed.begin(), reversed.end()) && on_reversed.comparisons == n - 1 &&
+              on_reversed.runs == 1,
+          "entrada invertida: um run invertido em O(n)");
+
+    // Timestamps anexados: ordenados com poucos atrasados
+    std::vector<int> appended(n);
+    for (std::size_t i = 0; i < n; ++i) appended[i] = static_cast<int>(i);
+    for (std::size_t k = 0; k < 100; ++k) appended[rng() % n] -= static_cast<int>(rng() % 50);
+    CountingStats on_appended;
+    power_sort(appended.begin(), appended.end(), std::less<int>(), on_appended);
+    check(std::is_sorted(appended.begin(), appended.end()) && on_appended.comparisons < 3 * n,
+          "quase ordenado: " + std::to_string(on_appended.comparisons) + " comparações para n = 10^6");
+
+    // Dois fluxos ordenados concatenados: um merge com galope
+    std::vector<int> feeds(n);
+    for (std::size_t i = 0; i < n / 2; ++i) {
+        feeds[i] = static_cast<int>(2 * i);
+        feeds[n / 2 + i] = static_cast<int>(2 * i + 1);
+    }
+    CountingStats on_feeds;
+    power_sort(feeds.begin(), feeds.end(), std::less<int>(), on_feeds);
+    check(std::is_sorted(feeds.begin(), feeds.end()) && on_feeds.runs == 2 && on_feeds.longest_run == n / 2,
+          "dois fluxos intercalados: 2 runs de n/2");
+
+    std::ostringstream report;
+    on_feeds.print_results(report);
+    check(report.str().find("Runs naturais: 2") != std::string::npos,
+          "print_results mostra runs junto de comparações e trocas");
+
+    std::cout << std::string(60, '=') << std::endl;
+    return test_summary();
+}
@@ -0,0 +1,87 @@
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+#include "radix_sort.h"
+#include "teste.h"
+
+template <typename Key, typename Generator>
+bool sorts_like_std(std::size_t n, Generator generate) {
+    std::vector<Key> keys(n);
+    for (Key& key : keys) key = generate();
+    std::vector<Key> expected = keys, eight = keys, eleven = keys;
+    std::sort(expected.begin(), expected.end());
+    radix_sort<8>(eight);
+    radix_sort<11>(eleven);
+    return eight == expected && eleven == expected;
+}
+
+int main() {
+    std::cout << "TESTES DO RADIX SORT" << std::endl;
+    std::cout << std::string(60, '=') << std::endl;
+
+    std::mt19937_64 rng(2024);
+    bool ok = true;
+    for (std::size_t n : {0, 1, 2, 100, 100000}) {
+        ok = ok && sorts_like_std<std::uint32_t>(n, [&] { return static_cast<std::uint32_t>(rng()); });
+        ok = ok && sorts_like_std<std::uint64_t>(n, [&] { return rng(); });
+    }
+    check(ok, "uint32 e uint64 com dígitos de 8 e 11 bits");
+
+    ok = true;
+    for (std::size_t n : {1, 100, 100000}) {
+        ok = ok && sorts_like_std<int>(n, [&] { return static_cast<int>(rng()); });
+        ok = ok && sorts_like_std<std::int64_t>(n, [&] { return static_cast<std::int64_t>(rng()); });
+        ok = ok && sorts_like_std<std::int16_t>(n, [&] { return static_cast<std::int16_t>(rng()); });
+    }
+    check(ok, "inteiros com sinal (negativos antes dos positivos)");
+
+    std::normal_distribution<double> normal(0.0, 1e6);
+    ok = sorts_like_std<float>(100000, [&] { return static_cast<float>(normal(rng)); }) &&
+         sorts_like_std<double>(100000, [&] { return normal(rng); });
+    check(ok, "float e double com sinais misturados");
+
+    std::vector<float> special = {0.0f, -0.0f, std::numeric_limits<float>::infinity(), -1.5f,
+                                  -std::numeric_limits<float>::infinity(), 1e-40f, -1e-40f, 3.0f};
+    radix_sort(special);
+    check(std::is_sorted(special.begin(), special.end()) && std::signbit(special[3]) &&
+              !std::signbit(special[4]),
+          "infinitos, subnormais e -0.0 antes de +0.0");
+
+    // Chaves pequenas em tipo largo: só as passadas dos dígitos usados
+    std::vector<std::uint64_t> narrow(100000);
+    for (std::uint64_t& key : narrow) key = (rng() % 1000) << 32;
+    std::vector<std::uint64_t> expected = narrow;
+    std::sort(expected.begin(), expected.end());
+    radix_sort(narrow);
+    check(narrow == expected, "passadas com dígito constante são puladas sem perder a ordem");
+
+    std::vector<int> keys(50000);
+    for (int& key : keys) key = static_cast<int>(rng() % 100) - 50;
+    std::vector<std::uint32_t> order = radix_argsort(keys);
+    bool stable = true;
+    for (std::size_t i = 1; i < order.size(); ++i) {
+        int a = keys[order[i - 1]], b = keys[order[i]];
+        stable = stable && (a < b || (a == b && order[i - 1] < order[i]));
+    }
+    check(stable, "argsort estável (iguais mantêm a ordem de entrada)");
+
+    std::vector<float> pair_keys = {3.5f, -1.0f, 2.0f, -1.0f};
+    std::vector<std::string> values = {"c", "a", "b", "a2"};
+    radix_sort_pairs(pair_keys, values);
+    check(values == std::vector<std::string>({"a", "a2", "b", "c"}), "pares chave-valor");
+
+    bool threw = false;
+    try {
+        radix_sort_pairs(pair_keys, order);
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    check(threw, "tamanhos diferentes lançam invalid_argument");
+
+    std::cout << std::string(60, '=') << std::endl;
+    return test_summary();
+}
@@ -0,0 +1,103 @@
+#include <algorithm>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include "pdq_sort.h"
+#include "redes_ordenacao.h"
+#include "teste.h"
+
+std::mt19937_64 rng(31);
+
+template <typename T>
+T random_value(int range) {
+    return static_cast<T>(static_cast<long long>(rng() % (2 * range)) - range);
+}
+
+template <typename T, std::size_t N>
+bool network_sorts() {
+    for (int trial = 0; trial < 200; ++trial) {
+        std::vector<T> data(N);
+        for (T& x : data) x = random_value<T>(trial % 2 ? 5 : 1000000);
+        std::vector<T> expected = data;
+        std::sort(expected.begin(), expected.end());
+        sorting_network<N>(data.data());
+        if (data != expected) return false;
+    }
+    return true;
+}
+
+template <typename T>
+bool all_networks() {
+    return network_sorts<T, 8>() && network_sorts<T, 16>() && network_sorts<T, 32>() && network_sorts<T, 64>();
+}
+
+template <typename T>
+bool partial_sizes() {
+    for (std::size_t n = 0; n <= NETWORK_MAX_SIZE; ++n) {
+        std::vector<T> data(n);
+        for (T& x : data) x = random_value<T>(1000);
+        std::vector<T> expected = data;
+        std::sort(expected.begin(), expected.end());
+        network_sort(data.data(), n);
+        if (data != expected) return false;
+    }
+    return true;
+}
+
+template <typename T>
+bool partitions() {
+    for (std::size_t n : {0, 1, 3, 7, 8, 15, 16, 17, 31, 100, 1000, 4097}) {
+        for (int range : {3, 1000}) {
+            std::vector<T> data(n);
+            for (T& x : data) x = random_value<T>(range);
+            T pivot = random_value<T>(range);
+            std::vector<T> before = data;
+            std::size_t k = vector_partition(data.data(), n, pivot);
+            bool split = std::all_of(data.begin(), data.begin() + k, [&](T x) { return x < pivot; }) &&
+                         std::all_of(data.begin() + k, data.end(), [&](T x) { return !(x < pivot); });
+            std::sort(before.begin(), before.end());
+            std::sort(data.begin(), data.end());
+            if (!split || before != data) return false;
+        }
+    }
+    return true;
+}
+
+template <typename T>
+bool pdq_matches_std() {
+    for (std::size_t n : {10, 65, 300, 100000}) {
+        for (int range : {2, 1000000}) {
+            std::vector<T> data(n);
+            for (T& x : data) x = random_value<T>(range);
+            std::vector<T> expected = data;
+            std::sort(expected.begin(), expected.end());
+            pdq_sort(data.begin(), data.end());
+            if (data != expected) return false;
+        }
+    }
+    return true;
+}
+
+int main() {
+    std::cout << "TESTES DAS REDES DE ORDENAÇÃO (" << (SIMD_SORT_AVAILABLE ? "AVX2" : "escalar") << ")"
+              << std::endl;
+    std::cout << std::string(60, '=') << std::endl;
+
+    check(all_networks<std::int32_t>() && all_networks<float>() && all_networks<std::int64_t>(),
+          "redes de 8, 16, 32 e 64 para int32, float e int64");
+    check(partial_sizes<std::int32_t>() && partial_sizes<float>() && partial_sizes<std::int64_t>(),
+          "network_sort para n = 0..64 (com preenchimento)");
+
+    std::vector<std::int32_t> extremes = {INT32_MAX, INT32_MIN, 0, INT32_MAX, -1, 1, INT32_MIN, 5};
+    sorting_network<8>(extremes.data());
+    check(std::is_sorted(extremes.begin(), extremes.end()), "valores extremos de int32");
+
+    check(partitions<std::int32_t>() && partitions<float>() && partitions<std::int64_t>(),
+          "partição vetorizada: menores à esquerda, mesmos elementos");
+    check(pdq_matches_std<std::int32_t>() && pdq_matches_std<float>() && pdq_matches_std<std::int64_t>(),
+          "pdq_sort com redes e partição vetorizada igual a std::sort");
+
+    std::cout << std::string(60, '=') << std::endl;
+    return test_summary();
+}
@@ -0,0 +1,86 @@
+#include <algorithm>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include "loser_tree.h"
+#include "sample_sort.h"
+#include "teste.h"
+
+struct Record {
+    std::uint64_t key;
+    std::uint32_t payload[6];
+};
+
+int main() {
+    std::cout << "TESTES DO SAMPLE SORT PARALELO" << std::endl;
+    std::cout << std::string(60, '=') << std::endl;
+
+    std::vector<std::vector<int>> sources = {{1, 4, 9}, {}, {2, 3, 10, 11}, {4, 5}, {0}};
+    LoserTree<int, std::less<int>> tree(sources.size(), std::less<int>());
+    std::vector<std::size_t> cursor(sources.size(), 0);
+    for (std::size_t s = 0; s < sources.size(); ++s) {
+        tree.set_source(s, sources[s].empty() ? nullptr : &sources[s][0]);
+    }
+    tree.build();
+    std::vector<int> merged;
+    std::vector<std::size_t> origin;
+    while (!tree.empty()) {
+        std::size_t s = tree.winner();
+        merged.push_back(tree.top());
+        origin.push_back(s);
+        ++cursor[s];
+        tree.replace_winner(cursor[s] == sources[s].size() ? nullptr : &sources[s][cursor[s]]);
+    }
+    check(merged == std::vector<int>({0, 1, 2, 3, 4, 4, 5, 9, 10, 11}) && origin[4] == 0 && origin[5] == 3,
+          "árvore de perdedores intercala 5 fontes (empate vai para a de menor índice)");
+
+    std::mt19937_64 rng(99);
+    bool ok = true;
+    for (unsigned threads : {1u, 3u, 4u, 8u}) {
+        ThreadPool pool(threads);
+        for (std::size_t n : {0, 1, 1000, 200000, 1000003}) {
+            std::vector<std::uint32_t> data(n);
+            for (std::uint32_t& x : data) x = static_cast<std::uint32_t>(rng());
+            std::vector<std::uint32_t> expected = data;
+            std::sort(expected.begin(), expected.end());
+            sample_sort(pool, data.begin(), data.end());
+            ok = ok && data == expected;
+        }
+    }
+    check(ok, "mesmo resultado que std::sort para 1, 3, 4 e 8 threads");
+
+    ThreadPool pool(4);
+    std::vector<int> few(500000);
+    for (int& x : few) x = static_cast<int>(rng() % 5);
+    sample_sort(pool, few.begin(), few.end());
+    check(std::is_sorted(few.begin(), few.end()), "muitas chaves repetidas");
+
+    std::vector<int> sorted(500000);
+    for (std::size_t i = 0; i < sorted.size(); ++i) sorted[i] = static_cast<int>(sorted.size() - i);
+    sample_sort(pool, sorted.begin(), sorted.end(), std::greater<int>());
+    check(std::is_sorted(sorted.begin(), sorted.end(), std::greater<int>()),
+          "entrada já ordenada com comparador decrescente");
+
+    std::vector<Record> records(300000);
+    for (std::size_t i = 0; i < records.size(); ++i) {
+        records[i].key = rng() % 100000;
+        records[i].payload[0] = static_cast<std::uint32_t>(records[i].key * 7);
+    }
+    sample_sort(pool, records.begin(), records.end(),
+                [](const Record& a, const Record& b) { return a.key < b.key; });
+    bool records_ok = true;
+    for (std::size_t i = 0; i < records.size(); ++i) {
+        records_ok = records_ok && records[i].payload[0] == records[i].key * 7 &&
+                     (i == 0 || records[i - 1].key <= records[i].key);
+    }
+    check(records_ok, "registros com chave e carga útil");
+
+    std::vector<int> small_threshold(5000);
+    for (int& x : small_threshold) x = static_cast<int>(rng());
+    sample_sort(pool, small_threshold.begin(), small_threshold.end(), std::less<int>(), 1000);
+    check(std::is_sorted(small_threshold.begin(), small_threshold.end()), "limiar sequencial configurável");
+
+    std::cout << std::string(60, '=') << std::endl;
+    return test_summary();
+}